@@ -104,6 +104,7 @@ Field::Field(
     , m_info(std::move(info))
     , m_id(fid)
     , m_state(state)
+    , m_data_version(repo.next_data_version())
 {}
 
 Field::~Field() = default;
@@ -198,6 +199,7 @@ void Field::fillpatch(amrex::Real time, amrex::IntVect ng) noexcept
         fop.fillpatch(
             lev, time, m_repo.get_multifab(m_id, lev), ng, field_state());
     }
+    mark_modified();
 }
 
 void Field::fillpatch(amrex::Real time) noexcept
@@ -229,6 +231,7 @@ void Field::fillphysbc(amrex::Real time, amrex::IntVect ng) noexcept
         fop.fillphysbc(
             lev, time, m_repo.get_multifab(m_id, lev), ng, field_state());
     }
+    mark_modified();
 }
 
 void Field::fillphysbc(amrex::Real time) noexcept
@@ -242,6 +245,7 @@ void Field::apply_bc_funcs(const FieldState rho_state) noexcept
     for (auto& func : m_info->m_bc_func) {
         (*func)(*this, rho_state);
     }
+    mark_modified();
 }
 
 void Field::set_inflow(
@@ -264,15 +268,21 @@ void Field::advance_states() noexcept
         return;
     }
 
+    // Rotate the underlying storage instead of copying data. The MultiFab
+    // objects held by the repository stay at the same addresses, so any
+    // references obtained through `state(...)(lev)` remain valid after the
+    // rotation. Processing from the oldest state down moves the data one
+    // step back, e.g., (New, Old, NM1) -> (Old, NM1, New).
     for (int i = num_time_states() - 1; i > 0; --i) {
         const auto sold = static_cast<FieldState>(i);
         const auto snew = static_cast<FieldState>(i - 1);
         auto& old_field = state(sold);
         auto& new_field = state(snew);
         for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
-            amrex::MultiFab::Copy(
-                old_field(lev), new_field(lev), 0, 0, num_comp(), num_grow());
+            std::swap(old_field(lev), new_field(lev));
         }
+        std::swap(old_field.m_mesh_mapped, new_field.m_mesh_mapped);
+        std::swap(old_field.m_data_version, new_field.m_data_version);
     }
 }
 
@@ -286,6 +296,12 @@ void Field::copy_state(FieldState to_state, FieldState from_state) noexcept
         amrex::MultiFab::Copy(
             to_field(lev), from_field(lev), 0, 0, num_comp(), num_grow());
     }
+    to_field.mark_modified();
+}
+
+void Field::mark_modified() noexcept
+{
+    m_data_version = m_repo.next_data_version();
 }
 
 Field& Field::create_state(const FieldState fstate) noexcept
@@ -304,6 +320,7 @@ void Field::setVal(amrex::Real value) noexcept
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
         operator()(lev).setVal(value);
     }
+    mark_modified();
 }
 
 void Field::setVal(
@@ -313,6 +330,7 @@ void Field::setVal(
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
         operator()(lev).setVal(value, start_comp, num_comp, nghost);
     }
+    mark_modified();
 }
 
 void Field::setVal(
@@ -330,6 +348,7 @@ void Field::setVal(
             mf.setVal(value, ic, ncomp, nghost);
         }
     }
+    mark_modified();
 }
 
 void Field::set_default_fillpatch_bc(
@@ -380,6 +399,7 @@ void Field::to_uniform_space() noexcept
         }
     }
     m_mesh_mapped = true;
+    mark_modified();
 }
 
 void Field::to_stretched_space() noexcept
@@ -414,6 +434,7 @@ void Field::to_stretched_space() noexcept
         }
     }
     m_mesh_mapped = false;
+    mark_modified();
 }
 
 } // namespace amr_wind
@@ -1,6 +1,9 @@
 #include <memory>
 
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/fvm/gradient.H"
+
+#include "AMReX_MultiFabUtil.H"
 
 namespace amr_wind {
 
@@ -23,6 +26,7 @@ void FieldRepo::make_new_level_from_scratch(
     allocate_field_data(
         ba, dm, *m_leveldata[lev], *(m_leveldata[lev]->m_int_fact));
 
+    mark_all_modified();
     m_is_initialized = true;
 }
 
@@ -47,6 +51,7 @@ void FieldRepo::make_new_level_from_coarse(
     }
 
     m_leveldata[lev] = std::move(ldata);
+    mark_all_modified();
     m_is_initialized = true;
 }
 
@@ -71,6 +76,7 @@ void FieldRepo::remake_level(
     }
 
     m_leveldata[lev] = std::move(ldata);
+    mark_all_modified();
     m_is_initialized = true;
 }
 
@@ -78,6 +84,7 @@ void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
     m_leveldata[lev].reset();
+    mark_all_modified();
 }
 
 Field& FieldRepo::declare_field(
@@ -308,14 +315,15 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
 
     std::unique_ptr<ScratchField> field(
         new ScratchField(*this, name, ncomp, nghost, floc));
+    field->m_pool_generation = m_scratch_pool.generation();
 
     for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
         const auto ba =
             amrex::convert(m_mesh.boxArray(lev), field_impl::index_type(floc));
 
-        field->m_data.emplace_back(
-            ba, m_mesh.DistributionMap(lev), ncomp, nghost, amrex::MFInfo(),
-            *(m_leveldata[lev]->m_factory));
+        field->m_data.emplace_back(m_scratch_pool.acquire(
+            lev, ba, m_mesh.DistributionMap(lev), ncomp, field->num_grow(),
+            floc, *(m_leveldata[lev]->m_factory)));
     }
     return field;
 }
@@ -326,6 +334,17 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
     return create_scratch_field("scratch_field", ncomp, nghost, floc);
 }
 
+void FieldRepo::release_scratch_field(ScratchField& field) const
+{
+    const int nlevels = static_cast<int>(field.m_data.size());
+    for (int lev = 0; lev < nlevels; ++lev) {
+        m_scratch_pool.release(
+            lev, field.field_location(), field.m_pool_generation,
+            std::move(field.m_data[lev]));
+    }
+    field.m_data.clear();
+}
+
 void FieldRepo::advance_states() noexcept
 {
     for (auto& it : m_field_vec) {
@@ -336,6 +355,86 @@ void FieldRepo::advance_states() noexcept
     }
 }
 
+void FieldRepo::mark_all_modified()
+{
+    m_scratch_pool.clear();
+    // The mesh is updated after the callbacks, the masks are rebuilt on the
+    // next access
+    m_fine_masks.clear();
+    for (auto& field : m_field_vec) {
+        field->mark_modified();
+    }
+}
+
+const amrex::iMultiFab& FieldRepo::fine_mask(const int lev) const
+{
+    if (static_cast<int>(m_fine_masks.size()) != num_active_levels()) {
+        update_fine_masks();
+    }
+    return *m_fine_masks[lev];
+}
+
+void FieldRepo::update_fine_masks() const
+{
+    BL_PROFILE("amr-wind::FieldRepo::update_fine_masks");
+    const int nlevels = num_active_levels();
+    m_fine_masks.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if (lev < nlevels - 1) {
+            m_fine_masks[lev] =
+                std::make_unique<amrex::iMultiFab>(amrex::makeFineMask(
+                    m_mesh.boxArray(lev), m_mesh.DistributionMap(lev),
+                    m_mesh.boxArray(lev + 1), m_mesh.refRatio(lev), 1, 0));
+        } else {
+            m_fine_masks[lev] = std::make_unique<amrex::iMultiFab>(
+                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev), 1, 0,
+                amrex::MFInfo());
+            m_fine_masks[lev]->setVal(1);
+        }
+    }
+}
+
+const Field& FieldRepo::cached_gradient(const Field& field)
+{
+    BL_PROFILE("amr-wind::FieldRepo::cached_gradient");
+    AMREX_ALWAYS_ASSERT(field.field_location() == FieldLoc::CELL);
+
+    auto found = m_grad_cache.find(field.id());
+    if (found == m_grad_cache.end()) {
+        const std::string gname =
+            field.base_name() + "_cached_gradient" +
+            std::to_string(static_cast<int>(field.field_state()));
+        auto& grad = declare_field(gname, field.num_comp() * AMREX_SPACEDIM);
+        found = m_grad_cache.emplace(field.id(), GradientCacheEntry{&grad, 0})
+                    .first;
+    }
+
+    auto& entry = found->second;
+    if (entry.version == field.data_version()) {
+        return *entry.grad;
+    }
+
+    // After the time states are rotated the gradient of the current data is
+    // held by the entry of another state. Swap the storage instead of
+    // recomputing it.
+    for (int i = 0; i < field.num_time_states(); ++i) {
+        const auto fstate = static_cast<FieldState>(i);
+        if ((fstate == field.field_state()) || !field.query_state(fstate)) {
+            continue;
+        }
+        auto other = m_grad_cache.find(field.state(fstate).id());
+        if ((other != m_grad_cache.end()) &&
+            (other->second.version == field.data_version())) {
+            std::swap(entry, other->second);
+            return *entry.grad;
+        }
+    }
+
+    fvm::gradient(*entry.grad, field);
+    entry.version = field.data_version();
+    return *entry.grad;
+}
+
 void FieldRepo::allocate_field_data(
     const amrex::BoxArray& ba,
     const amrex::DistributionMapping& dm,
@@ -46,6 +46,11 @@ void MLMGOptions::parse_options(const std::string& prefix)
 
     pp.query("do_fixed_iters", do_fixed_iters);
 
+    // Warm start is only supported by the projections
+    if ((prefix == "nodal_proj") || (prefix == "mac_proj")) {
+        pp.query("warm_start", warm_start);
+    }
+
     pp.query("bottom_maxiter", bottom_max_iter);
     pp.query("bottom_rtol", bottom_rel_tol);
     pp.query("bottom_atol", bottom_abs_tol);
@@ -73,6 +78,12 @@ void MLMGOptions::operator()(amrex::MLMG& mlmg)
     mlmg.setFinalSmooth(num_final_smooth);
     mlmg.setBottomSmooth(num_bottom_smooth);
 
+    // With a non-zero initial guess the initial residual can be much smaller
+    // than the RHS, measure convergence against the RHS norm instead
+    if (warm_start) {
+        mlmg.setAlwaysUseBNorm(1);
+    }
+
     mlmg.setBottomVerbose(bottom_verbose);
     mlmg.setBottomTolerance(bottom_rel_tol);
     mlmg.setBottomToleranceAbs(bottom_abs_tol);
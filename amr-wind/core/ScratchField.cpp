@@ -47,6 +47,8 @@ scratch_field_bcrec(const amrex::Geometry& geom, const int ncomp)
 
 } // namespace
 
+ScratchField::~ScratchField() { m_repo.release_scratch_field(*this); }
+
 void ScratchField::fillpatch(amrex::Real time) noexcept
 {
     fillpatch(time, num_grow());
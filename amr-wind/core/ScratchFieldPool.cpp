@@ -0,0 +1,97 @@
+#include "amr-wind/core/ScratchFieldPool.H"
+
+#include "AMReX_ParallelDescriptor.H"
+
+namespace amr_wind {
+
+ScratchFieldPool::Key ScratchFieldPool::make_key(
+    const int lev,
+    const int ncomp,
+    const amrex::IntVect& nghost,
+    const FieldLoc floc)
+{
+    return Key{
+        lev, ncomp, nghost[0], nghost[1], nghost[2], static_cast<int>(floc)};
+}
+
+amrex::Long ScratchFieldPool::num_bytes(const amrex::MultiFab& mfab)
+{
+    amrex::Long nbytes = 0;
+    for (amrex::MFIter mfi(mfab); mfi.isValid(); ++mfi) {
+        nbytes += static_cast<amrex::Long>(mfab[mfi].nBytes());
+    }
+    return nbytes;
+}
+
+amrex::MultiFab ScratchFieldPool::acquire(
+    const int lev,
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm,
+    const int ncomp,
+    const amrex::IntVect& nghost,
+    const FieldLoc floc,
+    const amrex::FabFactory<amrex::FArrayBox>& factory)
+{
+    auto found = m_pool.find(make_key(lev, ncomp, nghost, floc));
+    if ((found != m_pool.end()) && !found->second.empty()) {
+        amrex::MultiFab mfab(std::move(found->second.back()));
+        found->second.pop_back();
+        AMREX_ASSERT(mfab.boxArray() == ba);
+        AMREX_ASSERT(mfab.DistributionMap() == dm);
+        ++m_stats.hits;
+        return mfab;
+    }
+
+    amrex::MultiFab mfab(ba, dm, ncomp, nghost, amrex::MFInfo(), factory);
+    ++m_stats.misses;
+    m_stats.bytes += num_bytes(mfab);
+    m_stats.peak_bytes = amrex::max(m_stats.peak_bytes, m_stats.bytes);
+    return mfab;
+}
+
+void ScratchFieldPool::release(
+    const int lev,
+    const FieldLoc floc,
+    const int generation,
+    amrex::MultiFab&& mfab)
+{
+    if (!mfab.ok()) {
+        return;
+    }
+
+    // Buffer allocated for a mesh layout that no longer exists
+    if (generation != m_generation) {
+        m_stats.bytes -= num_bytes(mfab);
+        return;
+    }
+
+    m_pool[make_key(lev, mfab.nComp(), mfab.nGrowVect(), floc)].emplace_back(
+        std::move(mfab));
+}
+
+void ScratchFieldPool::clear()
+{
+    for (const auto& entry : m_pool) {
+        for (const auto& mfab : entry.second) {
+            m_stats.bytes -= num_bytes(mfab);
+        }
+    }
+    m_pool.clear();
+    ++m_generation;
+}
+
+void ScratchFieldPool::print_stats(std::ostream& os) const
+{
+    amrex::Long peak_bytes = m_stats.peak_bytes;
+    amrex::ParallelDescriptor::ReduceLongMax(peak_bytes);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        os << "Scratch field pool: hits = " << m_stats.hits
+           << ", misses = " << m_stats.misses
+           << ", peak memory per rank (MB) = "
+           << static_cast<double>(peak_bytes) / (1024.0 * 1024.0)
+           << std::endl;
+    }
+}
+
+} // namespace amr_wind
@@ -0,0 +1,76 @@
+#include "amr-wind/core/TileWorkspace.H"
+
+#include "AMReX_Arena.H"
+#include "AMReX_Gpu.H"
+#include "AMReX_OpenMP.H"
+
+namespace amr_wind {
+
+TileWorkspace::~TileWorkspace()
+{
+    if (m_data != nullptr) {
+        amrex::Gpu::streamSynchronizeAll();
+        amrex::The_Arena()->free(m_data);
+    }
+}
+
+void TileWorkspace::prepare(
+    const amrex::MultiFab& mfab, const int ngrow, const int ncomp)
+{
+    AMREX_ASSERT(!amrex::OpenMP::in_parallel());
+
+    amrex::Long npts = 0;
+    for (const int idx : mfab.IndexArray()) {
+        npts = amrex::max(npts, amrex::grow(mfab.box(idx), ngrow).numPts());
+    }
+
+#ifdef AMREX_USE_GPU
+    const int nslots = amrex::Gpu::numGpuStreams();
+#else
+    const int nslots = amrex::OpenMP::get_max_threads();
+#endif
+
+    const amrex::Long slot_size = npts * ncomp;
+    if ((slot_size <= m_slot_size) && (nslots <= m_nslots)) {
+        return;
+    }
+
+    // Kernels using the existing slots may still be in flight
+    if (m_data != nullptr) {
+        amrex::Gpu::streamSynchronizeAll();
+        amrex::The_Arena()->free(m_data);
+    }
+
+    m_slot_size = amrex::max(slot_size, m_slot_size);
+    m_nslots = amrex::max(nslots, m_nslots);
+    m_data = static_cast<amrex::Real*>(amrex::The_Arena()->alloc(
+        sizeof(amrex::Real) * m_slot_size * m_nslots));
+}
+
+int TileWorkspace::slot_index() noexcept
+{
+#ifdef AMREX_USE_GPU
+    return amrex::Gpu::Device::streamIndex();
+#else
+    return amrex::OpenMP::get_thread_num();
+#endif
+}
+
+amrex::Real* TileWorkspace::slot(
+    const amrex::Box& bx, const int ncomp, const bool zero) const
+{
+    const int islot = slot_index();
+    AMREX_ALWAYS_ASSERT(islot < m_nslots);
+    const amrex::Long npts = bx.numPts() * ncomp;
+    AMREX_ALWAYS_ASSERT(npts <= m_slot_size);
+
+    amrex::Real* ptr = m_data + islot * m_slot_size;
+    if (zero) {
+        amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(amrex::Long i) noexcept {
+            ptr[i] = 0.0;
+        });
+    }
+    return ptr;
+}
+
+} // namespace amr_wind
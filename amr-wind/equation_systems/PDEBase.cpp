@@ -65,12 +65,16 @@ int PDEMgr::num_ghost_state() const
 void PDEMgr::advance_states()
 {
     if (m_constant_density) {
-        m_sim.repo().get_field("density").advance_states();
+        // Density is not transported, but the new state is used throughout
+        // the timestep and must hold the current values
+        auto& density = m_sim.repo().get_field("density");
+        density.advance_states();
+        density.copy_state(FieldState::New, FieldState::Old);
     }
 
-    icns().fields().field.advance_states();
+    icns().advance_states();
     for (auto& eqn : scalar_eqns()) {
-        eqn->fields().field.advance_states();
+        eqn->advance_states();
     }
 }
 
@@ -206,11 +206,24 @@ void MacProjOp::operator()(const FieldState fstate, const amrex::Real dt)
         m_mac_proj->project(
             phif->vec_ptrs(), m_options.rel_tol, m_options.abs_tol);
 
+    } else if (m_options.warm_start) {
+        // With beta = 1/rho the MAC phi is not the pressure, so the solution
+        // from the previous MAC projection is used as the initial guess
+        if (!m_phi) {
+            m_phi = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::CELL);
+            for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+                (*m_phi)(lev).setVal(0.0);
+            }
+        }
+
+        m_mac_proj->project(
+            m_phi->vec_ptrs(), m_options.rel_tol, m_options.abs_tol);
     } else {
         m_mac_proj->project(m_options.rel_tol, m_options.abs_tol);
     }
 
-    io::print_mlmg_info("MAC_projection", m_mac_proj->getMLMG());
+    io::print_mlmg_info(
+        "MAC_projection", m_mac_proj->getMLMG(), m_options.warm_start);
 }
 
 void MacProjOp::mac_proj_to_uniform_space(
@@ -172,6 +172,10 @@ bool incflo::regrid_and_update()
         amrex::Print() << "Regrid mesh ... ";
         amrex::Real rstart = amrex::ParallelDescriptor::second();
         regrid(0, m_time.current_time());
+        // Force rebuild of the nodal projector on the new grids
+        m_nodal_proj.reset();
+        // Rebuild the cached fine-covered masks for the new grids
+        m_repo.update_fine_masks();
         amrex::Real rend = amrex::ParallelDescriptor::second() - rstart;
         amrex::Print() << "time elapsed = " << rend << std::endl;
         if (ParallelDescriptor::IOProcessor()) {
@@ -247,6 +251,7 @@ void incflo::post_advance_work()
     if (m_time.write_plot_file()) {
         m_sim.io_manager().write_plot_file();
     }
+    m_sim.io_manager().write_output_profiles();
 
     if (m_time.write_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
@@ -263,6 +268,7 @@ void incflo::Evolve()
 
     while (m_time.new_timestep()) {
         amrex::Real time0 = amrex::ParallelDescriptor::second();
+        m_nodal_proj_saved_time = 0.0;
 
         regrid_and_update();
 
@@ -282,7 +288,8 @@ void incflo::Evolve()
                        << " Solve: " << std::setprecision(4) << (time2 - time1)
                        << " Post: " << std::setprecision(3) << (time3 - time2)
                        << " Total: " << std::setprecision(4) << (time3 - time0)
-                       << std::endl;
+                       << " ProjSetupSaved: " << std::setprecision(3)
+                       << m_nodal_proj_saved_time << std::endl;
 
         amrex::Print() << "Solve time per cell: " << std::setprecision(4)
                        << amrex::ParallelDescriptor::NProcs() *
@@ -293,6 +300,10 @@ void incflo::Evolve()
     amrex::Print() << "\n======================================================"
                       "========================\n"
                    << std::endl;
+    m_repo.scratch_pool().print_stats(amrex::OutStream());
+    for (auto& pp : m_sim.physics()) {
+        pp->post_evolve_actions();
+    }
 
     // Output at final time
     if (m_time.write_last_plot_file()) {
@@ -301,6 +312,7 @@ void incflo::Evolve()
     if (m_time.write_last_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+    m_sim.io_manager().fence_checkpoints();
 }
 
 // Make a new level from scratch using provided BoxArray and
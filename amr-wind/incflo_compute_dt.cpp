@@ -1,5 +1,5 @@
 #include "amr-wind/incflo.H"
-#include "amr-wind/equation_systems/vof/volume_fractions.H"
+#include "amr-wind/utilities/cfl_utils.H"
 
 #include <cmath>
 #include <limits>
@@ -40,6 +40,7 @@ void incflo::ComputeDt(bool explicit_diffusion)
     Real diff_cfl = 0.0;
     Real force_cfl = 0.0;
     const bool mesh_mapping = m_sim.has_mesh_mapping();
+    const bool has_vof = m_sim.pde_manager().has_pde("VOF");
 
     const auto& den = density();
     amr_wind::Field const* mesh_fac =
@@ -53,128 +54,22 @@ void incflo::ComputeDt(bool explicit_diffusion)
         MultiFab const& vel_force = icns().fields().src_term(lev);
         MultiFab const& mu = icns().fields().mueff(lev);
         MultiFab const& rho = den(lev);
-
-        auto const& vel_arr = vel.const_arrays();
-        MultiArray4<Real const> fac_arr =
-            mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
-                         : MultiArray4<Real const>();
-
-        Real conv_lev = 0.0;
-        Real mphase_conv_lev = 0.0;
-        Real diff_lev = 0.0;
-        Real force_lev = 0.0;
-
-        conv_lev += amrex::ParReduce(
-            TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-            [=] AMREX_GPU_HOST_DEVICE(
-                int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                auto const& v_bx = vel_arr[box_no];
-
-                amrex::Real fac_x =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                amrex::Real fac_y =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                amrex::Real fac_z =
-                    mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                return amrex::max(
-                    amrex::Math::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x,
-                    amrex::Math::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                    amrex::Math::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                    -1.0);
-            });
-
-        if (m_sim.pde_manager().has_pde("VOF")) {
-            MultiFab const& vof = m_repo.get_field("vof")(lev);
-            auto const& vof_arr = vof.const_arrays();
-            mphase_conv_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& v_bx = vel_arr[box_no];
-                    auto const& vof_bx = vof_arr[box_no];
-
-                    // Check for interface
-                    auto is_near =
-                        amr_wind::multiphase::interface_band(i, j, k, vof_bx);
-
-                    // CFL calculation is not needed away from interface
-                    amrex::Real result = 0.0;
-                    if (is_near) {
-                        // Near interface, evaluate CFL by sum of velocities
-                        amrex::Real fac_x =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                        amrex::Real fac_y =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                        amrex::Real fac_z =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                        result = amrex::Math::abs(v_bx(i, j, k, 0)) * dxinv[0] /
-                                     fac_x +
-                                 amrex::Math::abs(v_bx(i, j, k, 1)) * dxinv[1] /
-                                     fac_y +
-                                 amrex::Math::abs(v_bx(i, j, k, 2)) * dxinv[2] /
-                                     fac_z;
-                    }
-                    return result;
-                });
-        }
-        conv_lev = amrex::max(conv_lev, mphase_conv_lev);
-
-        if (explicit_diffusion) {
-            auto const& mu_arr = mu.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            diff_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, rho, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& mu_bx = mu_arr[box_no];
-                    auto const& rho_bx = rho_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                    const Real dxinv2 =
-                        2.0 * (dxinv[0] / fac_x * dxinv[0] / fac_x +
-                               dxinv[1] / fac_y * dxinv[1] / fac_y +
-                               dxinv[2] / fac_z * dxinv[2] / fac_z);
-
-                    return amrex::max(
-                        mu_bx(i, j, k) * dxinv2 / rho_bx(i, j, k), -1.0);
-                });
-        }
-
-        if (m_time.use_force_cfl()) {
-            auto const& vf_arr = vel_force.const_arrays();
-            force_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel_force,
-                IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& vf_bx = vf_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                    return amrex::max(
-                        amrex::Math::abs(vf_bx(i, j, k, 0)) * dxinv[0] / fac_x,
-                        amrex::Math::abs(vf_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                        amrex::Math::abs(vf_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                        -1.0);
-                });
-        }
-
-        conv_cfl = amrex::max(conv_cfl, conv_lev);
-        diff_cfl = amrex::max(diff_cfl, diff_lev);
-        force_cfl = amrex::max(force_cfl, force_lev);
+        MultiFab const* vof =
+            has_vof ? &(m_repo.get_field("vof")(lev)) : nullptr;
+        MultiFab const* fac = mesh_mapping ? &((*mesh_fac)(lev)) : nullptr;
+
+        const auto cfl_lev =
+            mesh_mapping
+                ? amr_wind::cfl::compute_cfl_lev<true>(
+                      dxinv, vel, vel_force, mu, rho, vof, fac,
+                      explicit_diffusion, m_time.use_force_cfl())
+                : amr_wind::cfl::compute_cfl_lev<false>(
+                      dxinv, vel, vel_force, mu, rho, vof, fac,
+                      explicit_diffusion, m_time.use_force_cfl());
+
+        conv_cfl = amrex::max(conv_cfl, cfl_lev[0]);
+        diff_cfl = amrex::max(diff_cfl, cfl_lev[1]);
+        force_cfl = amrex::max(force_cfl, cfl_lev[2]);
     }
 
     ParallelAllReduce::Max<Real>(conv_cfl, ParallelContext::CommunicatorSub());
@@ -170,17 +170,7 @@ amrex::Real ChannelFlow::compute_error(const IndexSelector& idxOp)
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev),
-                m_mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_repo.fine_mask(lev);
 
         const auto& dx = m_mesh.Geom(lev).CellSizeArray();
         const auto& prob_lo = m_mesh.Geom(lev).ProbLoArray();
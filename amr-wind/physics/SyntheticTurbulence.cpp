@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 
 #include "amr-wind/physics/SyntheticTurbulence.H"
@@ -143,6 +144,20 @@ void process_nc_file(const std::string& turb_filename, SynthTurbData& turb_grid)
 #endif
 }
 
+//! Copy the perturbation velocities of the two planes to the device
+void copy_turb_data_to_device(SynthTurbData& turb_grid)
+{
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, turb_grid.uvel.begin(), turb_grid.uvel.end(),
+        turb_grid.uvel_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, turb_grid.vvel.begin(), turb_grid.vvel.end(),
+        turb_grid.vvel_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, turb_grid.wvel.begin(), turb_grid.wvel.end(),
+        turb_grid.wvel_d.begin());
+}
+
 /** Load two planes of data that bound the current timestep
  *
  *  The data for the y and z directions are loaded for the entire grid at the
@@ -193,20 +208,39 @@ void load_turb_plane_data(
 
     ncf.close();
 
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.uvel.begin(), turb_grid.uvel.end(),
-        turb_grid.uvel_d.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.vvel.begin(), turb_grid.vvel.end(),
-        turb_grid.vvel_d.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.wvel.begin(), turb_grid.wvel.end(),
-        turb_grid.wvel_d.begin());
+    copy_turb_data_to_device(turb_grid);
 #else
     amrex::ignore_unused(turb_filename, turb_grid, il, ir);
 #endif
 }
 
+#ifdef AMR_WIND_USE_NETCDF
+/** Read the perturbation velocities of a single plane
+ *
+ *  Called from the background reader thread, so it does not use the
+ *  profiler. The NetCDF calls are serialized with those of the other threads
+ *  by ncutils.
+ */
+void read_turb_plane(
+    const ncutils::NCFile& ncf,
+    const SynthTurbData& turb_grid,
+    const int idx,
+    double* uvel,
+    double* vvel,
+    double* wvel)
+{
+    // clang-format off
+    std::vector<size_t> start{{static_cast<size_t>(idx), 0, 0}};
+    std::vector<size_t> count{{1, static_cast<size_t>(turb_grid.box_dims[1]),
+                               static_cast<size_t>(turb_grid.box_dims[2])}};
+    // clang-format on
+
+    ncf.var("uvel").get(uvel, start, count);
+    ncf.var("vvel").get(vvel, start, count);
+    ncf.var("wvel").get(wvel, start, count);
+}
+#endif
+
 /** Determine the left/right indices for a given point along a particular
  * direction
  *
@@ -444,6 +478,15 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
     // Time offsets if any...
     pp.query("time_offset", m_time_offset);
 
+    // Number of planes read ahead in the background
+    pp.query("prefetch_planes", m_num_prefetch);
+#ifndef AMR_WIND_USE_NETCDF
+    if (m_num_prefetch > 0) {
+        amrex::Abort(
+            "SyntheticTurbulence: prefetch_planes requires NetCDF support.");
+    }
+#endif
+
     // Done reading user inputs, process derived data
 
     // Center of the grid
@@ -474,6 +517,175 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
                    << m_wind_profile->reference_velocity()
                    << " m/s; Dir = " << wind_direction
                    << " deg; type = " << mean_wind_type << std::endl;
+
+    if (m_num_prefetch > 0) {
+        // At least the two planes bounding the current time must fit
+        const int nx = m_turb_grid.box_dims[0];
+        AMREX_ALWAYS_ASSERT(nx > 0);
+        m_num_prefetch = amrex::max(2, amrex::min(m_num_prefetch, nx));
+        const size_t plane_size =
+            static_cast<size_t>(m_turb_grid.box_dims[1]) *
+            static_cast<size_t>(m_turb_grid.box_dims[2]);
+        m_ring.resize(m_num_prefetch);
+        for (auto& plane : m_ring) {
+            plane.uvel.resize(plane_size);
+            plane.vvel.resize(plane_size);
+            plane.wvel.resize(plane_size);
+        }
+        m_reader = std::thread([this]() { read_planes(); });
+    }
+}
+
+SyntheticTurbulence::~SyntheticTurbulence()
+{
+    if (m_reader.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_ring_mutex);
+            m_stop_reader = true;
+        }
+        m_ring_cv.notify_all();
+        m_reader.join();
+    }
+}
+
+void SyntheticTurbulence::post_evolve_actions()
+{
+    // Report the slowest rank, since all ranks wait for it in the next step
+    amrex::Real wait_time = m_io_wait_time;
+    amrex::ParallelDescriptor::ReduceRealMax(
+        wait_time, amrex::ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "SyntheticTurbulence: loaded planes "
+                   << m_num_plane_loads
+                   << " times, max time waiting for I/O = " << wait_time << " s"
+                   << std::endl;
+}
+
+bool SyntheticTurbulence::in_window(const int idx) const
+{
+    if (m_window_start < 0) {
+        return false;
+    }
+    const int nx = m_turb_grid.box_dims[0];
+    return (((idx - m_window_start + nx) % nx) < m_num_prefetch);
+}
+
+int SyntheticTurbulence::find_slot(const int idx) const
+{
+    for (int is = 0; is < m_num_prefetch; ++is) {
+        if (m_ring[is].index == idx) {
+            return is;
+        }
+    }
+    return -1;
+}
+
+bool SyntheticTurbulence::next_missing_plane(int& idx, int& slot) const
+{
+    if (m_window_start < 0) {
+        return false;
+    }
+
+    // Planes are read in the order in which they will be needed, into slots
+    // that hold planes outside the window
+    const int nx = m_turb_grid.box_dims[0];
+    for (int k = 0; k < m_num_prefetch; ++k) {
+        const int ip = (m_window_start + k) % nx;
+        if (find_slot(ip) > -1) {
+            continue;
+        }
+        for (int is = 0; is < m_num_prefetch; ++is) {
+            const int cur = m_ring[is].index;
+            if ((cur < 0) || !in_window(cur)) {
+                idx = ip;
+                slot = is;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SyntheticTurbulence::read_planes()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    auto ncf = ncutils::NCFile::open(m_turb_filename, NC_NOWRITE);
+
+    std::unique_lock<std::mutex> lock(m_ring_mutex);
+    while (true) {
+        int idx = -1;
+        int slot = -1;
+        m_ring_cv.wait(lock, [&]() {
+            return m_stop_reader || next_missing_plane(idx, slot);
+        });
+        if (m_stop_reader) {
+            break;
+        }
+
+        // The slot is not accessed by the main thread while it is filled
+        auto& plane = m_ring[slot];
+        plane.index = -1;
+        lock.unlock();
+        read_turb_plane(
+            ncf, m_turb_grid, idx, plane.uvel.data(), plane.vvel.data(),
+            plane.wvel.data());
+        lock.lock();
+        plane.index = idx;
+        m_ring_cv.notify_all();
+    }
+    lock.unlock();
+
+    ncf.close();
+#endif
+}
+
+void SyntheticTurbulence::load_planes(const int il, const int ir)
+{
+    BL_PROFILE("amr-wind::SyntheticTurbulence::load_planes");
+    ++m_num_plane_loads;
+    const amrex::Real tstart = amrex::ParallelDescriptor::second();
+    if (m_num_prefetch < 1) {
+        load_turb_plane_data(m_turb_filename, m_turb_grid, il, ir);
+        m_io_wait_time += amrex::ParallelDescriptor::second() - tstart;
+        return;
+    }
+
+    // Move the window so that the reader fetches the planes ahead of the
+    // current one, and wait until the two bounding planes are resident
+    int sl = -1;
+    int sr = -1;
+    {
+        std::unique_lock<std::mutex> lock(m_ring_mutex);
+        m_window_start = il;
+        m_ring_cv.notify_all();
+        m_ring_cv.wait(lock, [&]() {
+            sl = find_slot(il);
+            sr = find_slot(ir);
+            return (sl > -1) && (sr > -1);
+        });
+    }
+    m_io_wait_time += amrex::ParallelDescriptor::second() - tstart;
+
+    // The reader only refills slots outside the window, so these planes can be
+    // copied without holding the lock
+    const auto& lplane = m_ring[sl];
+    const auto& rplane = m_ring[sr];
+    const size_t offset = lplane.uvel.size();
+    std::copy(lplane.uvel.begin(), lplane.uvel.end(), m_turb_grid.uvel.begin());
+    std::copy(lplane.vvel.begin(), lplane.vvel.end(), m_turb_grid.vvel.begin());
+    std::copy(lplane.wvel.begin(), lplane.wvel.end(), m_turb_grid.wvel.begin());
+    std::copy(
+        rplane.uvel.begin(), rplane.uvel.end(),
+        m_turb_grid.uvel.begin() + offset);
+    std::copy(
+        rplane.vvel.begin(), rplane.vvel.end(),
+        m_turb_grid.vvel.begin() + offset);
+    std::copy(
+        rplane.wvel.begin(), rplane.wvel.end(),
+        m_turb_grid.wvel.begin() + offset);
+    m_turb_grid.ileft = il;
+    m_turb_grid.iright = ir;
+
+    copy_turb_data_to_device(m_turb_grid);
 }
 
 void SyntheticTurbulence::initialize_fields(
@@ -498,7 +710,7 @@ void SyntheticTurbulence::initialize()
     const amrex::Real eqivLen = m_wind_profile->reference_velocity() * curTime;
     int il, ir;
     get_lr_indices(m_turb_grid, 0, eqivLen, il, ir);
-    load_turb_plane_data(m_turb_filename, m_turb_grid, il, ir);
+    load_planes(il, ir);
 
     m_is_init = false;
 }
@@ -519,8 +731,7 @@ void SyntheticTurbulence::update()
 
     // Check if we need to refresh the planes
     if (weights.il != m_turb_grid.ileft) {
-        load_turb_plane_data(
-            m_turb_filename, m_turb_grid, weights.il, weights.ir);
+        load_planes(weights.il, weights.ir);
     }
 
     if (m_mean_wind_type == "ConstValue") {
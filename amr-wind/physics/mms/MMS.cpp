@@ -116,17 +116,7 @@ MMS::compute_error(const int comp, const Field& field, amr_wind::mms::FuncDef f)
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev),
-                m_mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_mesh.boxArray(lev), m_mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_repo.fine_mask(lev);
 
         const auto& dx = m_mesh.Geom(lev).CellSizeArray();
         const auto& problo = m_mesh.Geom(lev).ProbLoArray();
@@ -136,7 +126,7 @@ MMS::compute_error(const int comp, const Field& field, amr_wind::mms::FuncDef f)
         for (amrex::MFIter mfi(fld); mfi.isValid(); ++mfi) {
             const auto& vbx = mfi.validbox();
             const auto& field_arr = fld.array(mfi);
-            const auto& mask_arr = level_mask.array(mfi);
+            const auto& mask_arr = level_mask.const_array(mfi);
 
             amrex::Real err_fab = 0.0;
             amrex::LoopOnCpu(vbx, [=, &err_fab](int i, int j, int k) noexcept {
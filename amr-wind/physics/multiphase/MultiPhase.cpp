@@ -7,6 +7,7 @@
 #include "amr-wind/equation_systems/BCOps.H"
 #include <AMReX_MultiFabUtil.H>
 #include "amr-wind/core/SimTime.H"
+#include "amr-wind/utilities/GlobalIntegrals.H"
 
 namespace amr_wind {
 
@@ -52,6 +53,22 @@ MultiPhase::MultiPhase(CFDSim& sim)
         BCScalar bc_ls(*m_levelset);
         bc_ls(levelset_default);
     }
+
+    // Volume and momentum diagnostics are evaluated together with the other
+    // global integrals, every timestep if they are printed
+    const int diag_freq = (m_verbose > 0) ? 1 : 0;
+    auto& integrals = m_sim.integrals();
+    using Factor = GlobalIntegrals::Factor;
+    if (m_vof != nullptr) {
+        m_vof_sum_idx =
+            integrals.add_integrand({Factor{m_vof}}, 1.0, true, diag_freq);
+    }
+    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+        const auto op = GlobalIntegrals::FactorOp::Comp;
+        m_momentum_sum_idx[n] = integrals.add_integrand(
+            {Factor{&m_velocity, op, n}, Factor{&m_density}}, 1.0, true,
+            diag_freq);
+    }
 }
 
 InterfaceCapturingMethod MultiPhase::interface_capturing_method()
@@ -129,99 +146,15 @@ void MultiPhase::post_advance_work()
 
 amrex::Real MultiPhase::volume_fraction_sum()
 {
-    using namespace amrex;
     BL_PROFILE("amr-wind::multiphase::ComputeVolumeFractionSum");
-    const int nlevels = m_sim.repo().num_active_levels();
-    const auto& geom = m_sim.mesh().Geom();
-    const auto& mesh = m_sim.mesh();
-
-    amrex::Real total_volume_frac = 0.0;
-
-    for (int lev = 0; lev < nlevels; ++lev) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        auto& vof = (*m_vof)(lev);
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        total_volume_frac += amrex::ReduceSum(
-            vof, level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& volfrac,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real vol_fab = 0.0;
-                amrex::Loop(bx, [=, &vol_fab](int i, int j, int k) noexcept {
-                    vol_fab += volfrac(i, j, k) * mask_arr(i, j, k) * cell_vol;
-                });
-                return vol_fab;
-            });
-    }
-    amrex::ParallelDescriptor::ReduceRealSum(total_volume_frac);
-
-    return total_volume_frac;
+    AMREX_ALWAYS_ASSERT(m_vof_sum_idx >= 0);
+    return m_sim.integrals().value(m_vof_sum_idx);
 }
 
 amrex::Real MultiPhase::momentum_sum(int n)
 {
-    using namespace amrex;
-    BL_PROFILE("amr-wind::multiphase::ComputeVolumeFractionSum");
-    const int nlevels = m_sim.repo().num_active_levels();
-    const auto& geom = m_sim.mesh().Geom();
-    const auto& mesh = m_sim.mesh();
-
-    amrex::Real total_momentum = 0.0;
-
-    for (int lev = 0; lev < nlevels; ++lev) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        auto& velocity = m_sim.repo().get_field("velocity")(lev);
-        auto& density = m_sim.repo().get_field("density")(lev);
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        total_momentum += amrex::ReduceSum(
-            velocity, density, level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vel,
-                amrex::Array4<amrex::Real const> const& dens,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real vol_fab = 0.0;
-                amrex::Loop(bx, [=, &vol_fab](int i, int j, int k) noexcept {
-                    vol_fab += vel(i, j, k, n) * dens(i, j, k) *
-                               mask_arr(i, j, k) * cell_vol;
-                });
-                return vol_fab;
-            });
-    }
-    amrex::ParallelDescriptor::ReduceRealSum(total_momentum);
-
-    return total_momentum;
+    BL_PROFILE("amr-wind::multiphase::ComputeMomentumSum");
+    return m_sim.integrals().value(m_momentum_sum_idx[n]);
 }
 
 void MultiPhase::set_density_via_levelset()
@@ -1,13 +1,96 @@
 #include <AMReX_BC_TYPES.H>
+#include <AMReX_ParallelDescriptor.H>
 #include <memory>
 #include "amr-wind/incflo.H"
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/core/field_ops.H"
+#include "amr-wind/core/MeshMapArray.H"
 #include "amr-wind/wind_energy/ABL.H"
 
 using namespace amrex;
 
+namespace {
+
+/** Add the pressure gradient back to the velocity on a level
+ *
+ *  Accounts for mesh mapping in ( grad p / rho ) -> 1/fac * grad(p) * dt/rho.
+ *  The kernel is specialized on mesh mapping so that the uniform mesh path
+ *  does not load the scaling factors.
+ */
+template <bool MeshMap>
+void add_pressure_gradient(
+    MultiFab& velocity,
+    const MultiFab& density,
+    const MultiFab& grad_p,
+    const MultiFab* mesh_fac,
+    const Real scaling_factor)
+{
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(velocity, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Box const& bx = mfi.tilebox();
+        Array4<Real> const& u = velocity.array(mfi);
+        Array4<Real const> const& rho = density.const_array(mfi);
+        Array4<Real const> const& gp = grad_p.const_array(mfi);
+        const amr_wind::mesh_map::MapArray<MeshMap> fac(
+            MeshMap ? mesh_fac->const_array(mfi) : Array4<Real const>());
+
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                Real soverrho = scaling_factor / rho(i, j, k);
+                u(i, j, k, 0) +=
+                    1 / fac(i, j, k, 0) * gp(i, j, k, 0) * soverrho;
+                u(i, j, k, 1) +=
+                    1 / fac(i, j, k, 1) * gp(i, j, k, 1) * soverrho;
+                u(i, j, k, 2) +=
+                    1 / fac(i, j, k, 2) * gp(i, j, k, 2) * soverrho;
+            });
+    }
+}
+
+/** Compute sigma = 1/(fac^2)*J * dt/rho for the nodal projection on a level
+ *
+ *  \sa add_pressure_gradient
+ */
+template <bool MeshMap>
+void compute_projection_sigma(
+    MultiFab& sigma,
+    const MultiFab& density,
+    const MultiFab* mesh_fac,
+    const MultiFab* mesh_detJ,
+    const Real scaling_factor)
+{
+    const int ncomp = sigma.nComp();
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sigma, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Box const& bx = mfi.tilebox();
+        Array4<Real> const& sig = sigma.array(mfi);
+        Array4<Real const> const& rho = density.const_array(mfi);
+        const amr_wind::mesh_map::MapArray<MeshMap> fac(
+            MeshMap ? mesh_fac->const_array(mfi) : Array4<Real const>());
+        const amr_wind::mesh_map::MapArray<MeshMap> detJ(
+            MeshMap ? mesh_detJ->const_array(mfi) : Array4<Real const>());
+
+        amrex::ParallelFor(
+            bx, ncomp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                if (MeshMap) {
+                    sig(i, j, k, n) = std::pow(fac(i, j, k, n), -2.) *
+                                      detJ(i, j, k) * scaling_factor /
+                                      rho(i, j, k);
+                } else {
+                    sig(i, j, k, n) = scaling_factor / rho(i, j, k);
+                }
+            });
+    }
+}
+
+} // namespace
+
 void incflo::set_inflow_velocity(
     int lev, amrex::Real time, MultiFab& vel, int nghost)
 {
@@ -88,6 +171,11 @@ incflo::get_projection_bc(Orientation::Side side) const noexcept
  *  - If `incremental == true`, then the pressure term is not added to
  *    \f$u^{**}\f$ and the update is in delta-form.
  *
+ *  - The nodal projector is created on the first call and reused until the
+ *    next regrid; only the coefficients and RHS are updated between calls.
+ *    For constant density the coefficient is \f$1/\rho\f$, independent of
+ *    `scaling_factor`, so nothing in the projector changes between steps.
+ *
  *  Please consult [AMReX Linear
  *  Solvers](https://amrex-codes.github.io/amrex/docs_html/LinearSolvers.html#nodal-projection)
  *  documentation for more information on the nodal projection operator.
@@ -155,34 +243,14 @@ void incflo::ApplyProjection(
     // dt/rho
     if (!incremental) {
         for (int lev = 0; lev <= finest_level; lev++) {
-
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-            for (MFIter mfi(velocity(lev), TilingIfNotGPU()); mfi.isValid();
-                 ++mfi) {
-                Box const& bx = mfi.tilebox();
-                Array4<Real> const& u = velocity(lev).array(mfi);
-                Array4<Real const> const& rho = density[lev]->const_array(mfi);
-                Array4<Real const> const& gp = grad_p(lev).const_array(mfi);
-                amrex::Array4<amrex::Real const> fac =
-                    mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-
-                amrex::ParallelFor(
-                    bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        Real soverrho = scaling_factor / rho(i, j, k);
-                        amrex::Real fac_x =
-                            mesh_mapping ? (fac(i, j, k, 0)) : 1.0;
-                        amrex::Real fac_y =
-                            mesh_mapping ? (fac(i, j, k, 1)) : 1.0;
-                        amrex::Real fac_z =
-                            mesh_mapping ? (fac(i, j, k, 2)) : 1.0;
-
-                        u(i, j, k, 0) += 1 / fac_x * gp(i, j, k, 0) * soverrho;
-                        u(i, j, k, 1) += 1 / fac_y * gp(i, j, k, 1) * soverrho;
-                        u(i, j, k, 2) += 1 / fac_z * gp(i, j, k, 2) * soverrho;
-                    });
+            if (mesh_mapping) {
+                add_pressure_gradient<true>(
+                    velocity(lev), *density[lev], grad_p(lev),
+                    &(*mesh_fac)(lev), scaling_factor);
+            } else {
+                add_pressure_gradient<false>(
+                    velocity(lev), *density[lev], grad_p(lev), nullptr,
+                    scaling_factor);
             }
         }
     }
@@ -239,49 +307,43 @@ void incflo::ApplyProjection(
         velocity.to_uniform_space();
     }
 
+    // The nodal projector (and the MLMG hierarchy it holds) is reused across
+    // calls until the next regrid, see incflo::regrid_and_update
+    const bool need_init = !m_nodal_proj;
+
+    // For constant density, the projector is built with the dt-independent
+    // coefficient 1/rho, so it solves for dt * phi. The velocity update is
+    // unaffected, while phi and its gradient are rescaled after the solve.
+    const bool constant_coeff = !(variable_density || mesh_mapping);
+    const amrex::Real phi_scale = constant_coeff ? scaling_factor : 1.0;
+
+    amr_wind::MLMGOptions options("nodal_proj");
+
     // Create sigma while accounting for mesh mapping
     // sigma = 1/(fac^2)*J * dt/rho
-    Vector<amrex::MultiFab> sigma(finest_level + 1);
     if (variable_density || mesh_mapping) {
         int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
+        if (need_init) {
+            m_nodal_proj_sigma.clear();
+            m_nodal_proj_sigma.resize(finest_level + 1);
+        }
         for (int lev = 0; lev <= finest_level; ++lev) {
-            sigma[lev].define(
-                grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-            for (MFIter mfi(sigma[lev], TilingIfNotGPU()); mfi.isValid();
-                 ++mfi) {
-                Box const& bx = mfi.tilebox();
-                Array4<Real> const& sig = sigma[lev].array(mfi);
-                Array4<Real const> const& rho = density[lev]->const_array(mfi);
-                amrex::Array4<amrex::Real const> fac =
-                    mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-                amrex::Array4<amrex::Real const> detJ =
-                    mesh_mapping ? ((*mesh_detJ)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-
-                amrex::ParallelFor(
-                    bx, ncomp,
-                    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        amrex::Real fac_cc =
-                            mesh_mapping ? (fac(i, j, k, n)) : 1.0;
-                        amrex::Real det_j =
-                            mesh_mapping ? (detJ(i, j, k)) : 1.0;
-                        sig(i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
-                                          scaling_factor / rho(i, j, k);
-                    });
+            auto& sigma = m_nodal_proj_sigma[lev];
+            if (need_init) {
+                sigma.define(
+                    grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+            }
+            if (mesh_mapping) {
+                compute_projection_sigma<true>(
+                    sigma, *density[lev], &(*mesh_fac)(lev),
+                    &(*mesh_detJ)(lev), scaling_factor);
+            } else {
+                compute_projection_sigma<false>(
+                    sigma, *density[lev], nullptr, nullptr, scaling_factor);
             }
         }
     }
 
-    // Perform projection
-    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
-
-    auto bclo = get_projection_bc(Orientation::low);
-    auto bchi = get_projection_bc(Orientation::high);
-
     Vector<MultiFab*> vel;
     for (int lev = 0; lev <= finest_level; ++lev) {
         vel.push_back(&(velocity(lev)));
@@ -291,25 +353,40 @@ void incflo::ApplyProjection(
         }
     }
 
-    amr_wind::MLMGOptions options("nodal_proj");
+    if (need_init) {
+        const amrex::Real setup_start = amrex::ParallelDescriptor::second();
+        auto bclo = get_projection_bc(Orientation::low);
+        auto bchi = get_projection_bc(Orientation::high);
 
-    if (variable_density || mesh_mapping) {
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
-            options.lpinfo());
-    } else {
-        amrex::Real rho_0 = 1.0;
-        amrex::ParmParse pp("incflo");
-        pp.query("density", rho_0);
+        if (variable_density || mesh_mapping) {
+            m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+                vel, GetVecOfConstPtrs(m_nodal_proj_sigma),
+                Geom(0, finest_level), options.lpinfo());
+        } else {
+            amrex::Real rho_0 = 1.0;
+            amrex::ParmParse pp("incflo");
+            pp.query("density", rho_0);
+            m_nodal_proj_sigma_0 = 1.0 / rho_0;
+            m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+                vel, m_nodal_proj_sigma_0, Geom(0, finest_level),
+                options.lpinfo());
+        }
 
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, scaling_factor / rho_0, Geom(0, finest_level),
-            options.lpinfo());
+        // Set MLMG and NodalProjector options
+        options(*m_nodal_proj);
+        m_nodal_proj->setDomainBC(bclo, bchi);
+        m_nodal_proj_setup_time =
+            amrex::ParallelDescriptor::second() - setup_start;
+    } else {
+        if (variable_density || mesh_mapping) {
+            auto& linop = m_nodal_proj->getLinOp();
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                linop.setSigma(lev, m_nodal_proj_sigma[lev]);
+            }
+        }
+        m_nodal_proj_saved_time += m_nodal_proj_setup_time;
     }
-
-    // Set MLMG and NodalProjector options
-    options(*nodal_projector);
-    nodal_projector->setDomainBC(bclo, bchi);
+    auto& nodal_projector = m_nodal_proj;
 
     bool has_ib = m_sim.physics_manager().contains("IB");
     if (has_ib) {
@@ -336,23 +413,28 @@ void incflo::ApplyProjection(
         }
     }
 
-    if (m_sim.has_overset()) {
-        auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
-        if (incremental) {
+    // The reused projector holds phi from the previous solve, so the initial
+    // guess is always set explicitly. The solve is seeded with the current
+    // pressure for overset and optionally otherwise; for incremental
+    // projections phi is a pressure increment and the initial guess is zero.
+    const bool warm_start = options.warm_start && !incremental;
+    auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
+    if ((m_sim.has_overset() && !incremental) || warm_start) {
+        amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
+        if (constant_coeff) {
             for (int lev = 0; lev <= finestLevel(); ++lev) {
-                (*phif)(lev).setVal(0.0);
+                (*phif)(lev).mult(phi_scale);
             }
-        } else {
-            amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
         }
-
-        nodal_projector->project(
-            phif->vec_ptrs(), options.rel_tol, options.abs_tol);
     } else {
-        nodal_projector->project(options.rel_tol, options.abs_tol);
+        for (int lev = 0; lev <= finestLevel(); ++lev) {
+            (*phif)(lev).setVal(0.0);
+        }
     }
+    nodal_projector->project(
+        phif->vec_ptrs(), options.rel_tol, options.abs_tol);
     amr_wind::io::print_mlmg_info(
-        "Nodal_projection", nodal_projector->getMLMG());
+        "Nodal_projection", nodal_projector->getMLMG(), warm_start);
 
     // scale U^* back to -> U = fac/J * U^bar
     if (mesh_mapping) {
@@ -370,6 +452,7 @@ void incflo::ApplyProjection(
     // Get phi and fluxes
     auto phi = nodal_projector->getPhi();
     auto gradphi = nodal_projector->getGradPhi();
+    const amrex::Real phi_fac = 1.0 / phi_scale;
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
@@ -387,21 +470,21 @@ void incflo::ApplyProjection(
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) += phi_fac * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) += p_proj(i, j, k);
+                        p_lev(i, j, k) += phi_fac * p_proj(i, j, k);
                     });
             } else {
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) = phi_fac * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) = p_proj(i, j, k);
+                        p_lev(i, j, k) = phi_fac * p_proj(i, j, k);
                     });
             }
         }
@@ -1,8 +1,7 @@
 #include "amr-wind/turbulence/LES/OneEqKsgs.H"
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
-#include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/velocity_invariants.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 
@@ -90,12 +89,13 @@ void OneEqKsgsM84<Transport>::update_turbulent_viscosity(
     BL_PROFILE(
         "amr-wind::" + this->identifier() + "::update_turbulent_viscosity");
 
-    auto gradT = (this->m_sim.repo()).create_scratch_field(3, 0);
-    fvm::gradient(*gradT, m_temperature.state(fstate));
+    auto& frepo = this->m_sim.repo();
+    const auto& gradT = frepo.cached_gradient(m_temperature.state(fstate));
 
     const auto& vel = this->m_vel.state(fstate);
     // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
+    fvm::strainrate_from_gradient(
+        this->m_shear_prod, frepo.cached_gradient(vel));
 
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity{
         {m_gravity[0], m_gravity[1], m_gravity[2]}};
@@ -120,7 +120,7 @@ void OneEqKsgsM84<Transport>::update_turbulent_viscosity(
             const auto& bx = mfi.tilebox();
             const auto& mu_arr = mu_turb(lev).array(mfi);
             const auto& rho_arr = den(lev).const_array(mfi);
-            const auto& gradT_arr = (*gradT)(lev).array(mfi);
+            const auto& gradT_arr = gradT(lev).const_array(mfi);
             const auto& tlscale_arr = (this->m_turb_lscale)(lev).array(mfi);
             const auto& tke_arr = (*this->m_tke)(lev).array(mfi);
             const auto& buoy_prod_arr = (this->m_buoy_prod)(lev).array(mfi);
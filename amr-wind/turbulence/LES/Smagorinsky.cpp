@@ -2,7 +2,7 @@
 
 #include "amr-wind/turbulence/LES/Smagorinsky.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/velocity_invariants.H"
 #include "AMReX_REAL.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_ParmParse.H"
@@ -32,7 +32,7 @@ void Smagorinsky<Transport>::update_turbulent_viscosity(const FieldState fstate)
 
     // Populate strainrate into the turbulent viscosity arrays to avoid creating
     // a temporary buffer
-    fvm::strainrate(mu_turb, vel);
+    fvm::strainrate_from_gradient(mu_turb, m_vel.repo().cached_gradient(vel));
 
     const int nlevels = repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
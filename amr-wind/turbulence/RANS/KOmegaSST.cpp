@@ -3,7 +3,7 @@
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 #include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/velocity_invariants.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 #include "amr-wind/equation_systems/sdr/SDR.H"
@@ -77,7 +77,8 @@ void KOmegaSST<Transport>::update_turbulent_viscosity(const FieldState fstate)
 
     const auto& vel = this->m_vel.state(fstate);
     // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
+    fvm::strainrate_from_gradient(
+        this->m_shear_prod, repo.cached_gradient(vel));
 
     auto& tke_lhs = (this->m_sim).repo().get_field("tke_lhs_src_term");
     tke_lhs.setVal(0.0);
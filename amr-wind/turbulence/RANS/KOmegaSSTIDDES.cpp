@@ -3,7 +3,7 @@
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 #include "amr-wind/fvm/gradient.H"
-#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/velocity_invariants.H"
 #include "amr-wind/fvm/vorticity.H"
 #include "amr-wind/turbulence/turb_utils.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
@@ -100,7 +100,8 @@ void KOmegaSSTIDDES<Transport>::update_turbulent_viscosity(
 
     const auto& vel = this->m_vel.state(fstate);
     // Compute strain rate into shear production term
-    fvm::strainrate(this->m_shear_prod, vel);
+    fvm::strainrate_from_gradient(
+        this->m_shear_prod, repo.cached_gradient(vel));
 
     // Compute vorticity
     // auto vorticity = fvm::vorticity(vel);
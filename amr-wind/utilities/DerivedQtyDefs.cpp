@@ -17,7 +17,8 @@ void VorticityMag::operator()(ScratchField& fld, const int scomp)
 {
     AMREX_ASSERT(fld.num_comp() > (scomp));
     auto vort_mag = fld.subview(scomp, 1);
-    fvm::vorticity_mag(vort_mag, m_vel);
+    fvm::vorticity_mag_from_gradient(
+        vort_mag, m_vel.repo().cached_gradient(m_vel));
 }
 
 QCriterion::QCriterion(
@@ -31,7 +32,8 @@ void QCriterion::operator()(ScratchField& fld, const int scomp)
 {
     AMREX_ASSERT(fld.num_comp() > (scomp));
     auto q_crit = fld.subview(scomp, 1);
-    fvm::q_criterion(q_crit, m_vel);
+    fvm::q_criterion_from_gradient(
+        q_crit, m_vel.repo().cached_gradient(m_vel));
 }
 
 QCriterionNondim::QCriterionNondim(
@@ -45,7 +47,8 @@ void QCriterionNondim::operator()(ScratchField& fld, const int scomp)
 {
     AMREX_ASSERT(fld.num_comp() > (scomp));
     auto q_crit_nd = fld.subview(scomp, 1);
-    fvm::q_criterion(q_crit_nd, m_vel, true);
+    fvm::q_criterion_from_gradient(
+        q_crit_nd, m_vel.repo().cached_gradient(m_vel), true);
 }
 
 StrainRateMag::StrainRateMag(
@@ -59,7 +62,8 @@ void StrainRateMag::operator()(ScratchField& fld, const int scomp)
 {
     AMREX_ASSERT(fld.num_comp() > (scomp));
     auto srate = fld.subview(scomp, 1);
-    fvm::strainrate(srate, m_vel);
+    fvm::strainrate_from_gradient(
+        srate, m_vel.repo().cached_gradient(m_vel));
 }
 
 Gradient::Gradient(const FieldRepo& repo, const std::vector<std::string>& args)
@@ -252,6 +252,18 @@ void FPlaneAveraging<FType>::operator()()
     }
 }
 
+template <typename FType>
+void FPlaneAveraging<FType>::set_line_average(const amrex::Real* avg)
+{
+    m_last_updated_index = m_time.time_index();
+
+    std::copy(avg, avg + m_line_average.size(), m_line_average.begin());
+
+    if (m_comp_deriv) {
+        compute_line_derivatives();
+    }
+}
+
 template <typename FType>
 template <typename IndexSelector>
 void FPlaneAveraging<FType>::compute_averages(
@@ -359,6 +371,17 @@ void VelPlaneAveraging::operator()()
     }
 }
 
+void VelPlaneAveraging::set_line_hvelmag_average(const amrex::Real* avg)
+{
+    std::copy(
+        avg, avg + m_line_hvelmag_average.size(),
+        m_line_hvelmag_average.begin());
+
+    if (m_comp_deriv) {
+        compute_line_hvelmag_derivatives();
+    }
+}
+
 template <typename IndexSelector>
 void VelPlaneAveraging::compute_hvelmag_averages(
     const IndexSelector& idx_op,
@@ -0,0 +1,325 @@
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+
+#include <algorithm>
+
+namespace amr_wind {
+
+namespace {
+
+using FieldArrays = amrex::GpuArray<
+    amrex::Array4<amrex::Real const>,
+    FusedPlaneAveraging::max_fields>;
+
+/** Value of the product for moment `nf` of a term at a cell
+ *
+ *  Moments are stored in row-major order of the factor components.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real term_value(
+    const FusedPlaneAveraging::Term& term,
+    const FieldArrays& farrs,
+    const amrex::Real* line_avg,
+    const int i,
+    const int j,
+    const int k,
+    const int ind,
+    const int nf)
+{
+    if (term.hmag) {
+        const auto& farr = farrs[term.fld[0]];
+        const amrex::Real u1 = farr(i, j, k, term.hcomp[0]);
+        const amrex::Real u2 = farr(i, j, k, term.hcomp[1]);
+        return std::sqrt(u1 * u1 + u2 * u2);
+    }
+
+    int comp[FusedPlaneAveraging::max_order] = {0, 0, 0};
+    int rem = nf;
+    for (int d = term.order - 1; d >= 0; --d) {
+        comp[d] = rem % term.ncomp[d];
+        rem /= term.ncomp[d];
+    }
+
+    amrex::Real prod = 1.0;
+    for (int d = 0; d < term.order; ++d) {
+        amrex::Real val = farrs[term.fld[d]](i, j, k, comp[d]);
+        if (term.mean_offset[d] >= 0) {
+            val -=
+                line_avg[term.mean_offset[d] + term.ncomp[d] * ind + comp[d]];
+        }
+        prod *= val;
+    }
+    return prod;
+}
+
+} // namespace
+
+int FusedPlaneAveraging::register_field(const FieldPlaneAveraging& pa)
+{
+    if (m_axis < 0) {
+        m_axis = pa.axis();
+        m_level = pa.level();
+        m_ncell_line = pa.ncell_line();
+        m_ncell_plane = pa.ncell_plane();
+    }
+    AMREX_ALWAYS_ASSERT(pa.axis() == m_axis);
+    AMREX_ALWAYS_ASSERT(pa.level() == m_level);
+    AMREX_ALWAYS_ASSERT(pa.ncell_line() == m_ncell_line);
+    AMREX_ALWAYS_ASSERT(pa.ncell_plane() == m_ncell_plane);
+
+    const Field* fld = &pa.field();
+    auto it = std::find(m_fields.begin(), m_fields.end(), fld);
+    if (it != m_fields.end()) {
+        return static_cast<int>(it - m_fields.begin());
+    }
+
+    AMREX_ALWAYS_ASSERT(static_cast<int>(m_fields.size()) < max_fields);
+    m_fields.push_back(fld);
+    return static_cast<int>(m_fields.size()) - 1;
+}
+
+int FusedPlaneAveraging::append_term(Term& term)
+{
+    term.out_offset = static_cast<int>(m_line.size());
+    m_line.resize(
+        m_line.size() + static_cast<size_t>(m_ncell_line) * term.nmom);
+    m_terms.push_back(term);
+    m_term_lines.emplace_back(
+        static_cast<size_t>(m_ncell_line) * term.nmom, 0.0);
+    m_avg_pas.push_back(nullptr);
+    m_hmag_pas.push_back(nullptr);
+    return static_cast<int>(m_terms.size()) - 1;
+}
+
+int FusedPlaneAveraging::add_average(FieldPlaneAveraging& pa)
+{
+    // The fluctuations of other terms cannot use averages computed here
+    AMREX_ALWAYS_ASSERT(
+        std::find(m_mean_pas.begin(), m_mean_pas.end(), &pa) ==
+        m_mean_pas.end());
+
+    Term term;
+    term.order = 1;
+    term.fld[0] = register_field(pa);
+    term.ncomp[0] = pa.ncomp();
+    term.nmom = pa.ncomp();
+
+    const int idx = append_term(term);
+    m_avg_pas[idx] = &pa;
+    return idx;
+}
+
+int FusedPlaneAveraging::add_average(VelPlaneAveraging& pa)
+{
+    const int idx = add_average(static_cast<FieldPlaneAveraging&>(pa));
+
+    Term term;
+    term.order = 1;
+    term.hmag = true;
+    term.fld[0] = m_terms[idx].fld[0];
+    term.ncomp[0] = pa.ncomp();
+    term.nmom = 1;
+    switch (pa.axis()) {
+    case 0:
+        term.hcomp[0] = 1;
+        term.hcomp[1] = 2;
+        break;
+    case 1:
+        term.hcomp[0] = 0;
+        term.hcomp[1] = 2;
+        break;
+    default:
+        term.hcomp[0] = 0;
+        term.hcomp[1] = 1;
+        break;
+    }
+
+    const int hidx = append_term(term);
+    m_hmag_pas[hidx] = &pa;
+    return idx;
+}
+
+int FusedPlaneAveraging::add_moment(
+    const amrex::Vector<FieldPlaneAveraging*>& pas)
+{
+    const int order = static_cast<int>(pas.size());
+    AMREX_ALWAYS_ASSERT(order > 1 && order <= max_order);
+
+    Term term;
+    term.order = order;
+    term.nmom = 1;
+    for (int d = 0; d < order; ++d) {
+        const auto* pa = pas[d];
+        AMREX_ALWAYS_ASSERT(
+            std::find(m_avg_pas.begin(), m_avg_pas.end(), pa) ==
+            m_avg_pas.end());
+
+        term.fld[d] = register_field(*pa);
+        term.ncomp[d] = pa->ncomp();
+        term.nmom *= pa->ncomp();
+
+        auto it = std::find(m_mean_pas.begin(), m_mean_pas.end(), pa);
+        if (it == m_mean_pas.end()) {
+            const int offset =
+                m_mean_offsets.empty()
+                    ? 0
+                    : m_mean_offsets.back() +
+                          static_cast<int>(
+                              m_mean_pas.back()->line_average().size());
+            m_mean_pas.push_back(pa);
+            m_mean_offsets.push_back(offset);
+            term.mean_offset[d] = offset;
+        } else {
+            term.mean_offset[d] = m_mean_offsets[it - m_mean_pas.begin()];
+        }
+    }
+
+    return append_term(term);
+}
+
+void FusedPlaneAveraging::operator()()
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::operator");
+
+    if (m_terms.empty()) {
+        return;
+    }
+
+    switch (m_axis) {
+    case 0:
+        compute_moments(XDir());
+        break;
+    case 1:
+        compute_moments(YDir());
+        break;
+    case 2:
+        compute_moments(ZDir());
+        break;
+    default:
+        amrex::Abort("axis must be equal to 0, 1, or 2");
+        break;
+    }
+
+    update_terms();
+
+    m_last_updated_index = -1;
+    for (const auto* pa : m_mean_pas) {
+        m_last_updated_index =
+            amrex::max(m_last_updated_index, pa->last_updated_index());
+    }
+    for (const auto* pa : m_avg_pas) {
+        if (pa != nullptr) {
+            m_last_updated_index =
+                amrex::max(m_last_updated_index, pa->last_updated_index());
+        }
+    }
+}
+
+template <typename IndexSelector>
+void FusedPlaneAveraging::compute_moments(const IndexSelector& idxOp)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::compute_moments");
+
+    const amrex::Real denom = 1.0 / (amrex::Real)m_ncell_plane;
+
+    // Concatenate the averages used by the fluctuations
+    amrex::Vector<amrex::Real> means;
+    for (const auto* pa : m_mean_pas) {
+        means.insert(
+            means.end(), pa->line_average().begin(), pa->line_average().end());
+    }
+    amrex::Gpu::DeviceVector<amrex::Real> dmeans(means.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, means.begin(), means.end(), dmeans.begin());
+
+    amrex::Gpu::DeviceVector<Term> dterms(m_terms.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_terms.begin(), m_terms.end(),
+        dterms.begin());
+
+    std::fill(m_line.begin(), m_line.end(), 0.0);
+    amrex::AsyncArray<amrex::Real> lmom(m_line.data(), m_line.size());
+
+    amrex::Real* line_mom = lmom.data();
+    const amrex::Real* line_avg = dmeans.data();
+    const Term* terms = dterms.data();
+    const int nterms = static_cast<int>(m_terms.size());
+    const int nfields = static_cast<int>(m_fields.size());
+
+    const auto& mfab0 = (*m_fields[0])(m_level);
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab0, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        amrex::Box bx = mfi.tilebox();
+
+        FieldArrays farrs;
+        for (int f = 0; f < nfields; ++f) {
+            farrs[f] = (*m_fields[f])(m_level).const_array(mfi);
+        }
+
+        amrex::Box pbx =
+            PerpendicularBox<IndexSelector>(bx, amrex::IntVect{0, 0, 0});
+
+        amrex::ParallelFor(
+            amrex::Gpu::KernelInfo().setReduction(true), pbx,
+            [=] AMREX_GPU_DEVICE(
+                int p_i, int p_j, int p_k,
+                amrex::Gpu::Handler const& handler) noexcept {
+                // Loop over the direction perpendicular to the plane.
+                // This reduces the atomic pressure on the destination arrays.
+
+                amrex::Box lbx = ParallelBox<IndexSelector>(
+                    bx, amrex::IntVect{p_i, p_j, p_k});
+
+                for (int k = lbx.smallEnd(2); k <= lbx.bigEnd(2); ++k) {
+                    for (int j = lbx.smallEnd(1); j <= lbx.bigEnd(1); ++j) {
+                        for (int i = lbx.smallEnd(0); i <= lbx.bigEnd(0); ++i) {
+
+                            const int ind = idxOp(i, j, k);
+
+                            for (int t = 0; t < nterms; ++t) {
+                                const Term& term = terms[t];
+                                amrex::Real* lout =
+                                    line_mom + term.out_offset +
+                                    term.nmom * ind;
+                                for (int nf = 0; nf < term.nmom; ++nf) {
+                                    amrex::Gpu::deviceReduceSum(
+                                        &lout[nf],
+                                        term_value(
+                                            term, farrs, line_avg, i, j, k,
+                                            ind, nf) *
+                                            denom,
+                                        handler);
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+    }
+
+    lmom.copyToHost(m_line.data(), m_line.size());
+    amrex::ParallelDescriptor::ReduceRealSum(m_line.data(), m_line.size());
+}
+
+void FusedPlaneAveraging::update_terms()
+{
+    const int nterms = num_terms();
+    for (int t = 0; t < nterms; ++t) {
+        const auto& term = m_terms[t];
+        auto& tline = m_term_lines[t];
+        std::copy(
+            m_line.begin() + term.out_offset,
+            m_line.begin() + term.out_offset + tline.size(), tline.begin());
+
+        if (m_avg_pas[t] != nullptr) {
+            m_avg_pas[t]->set_line_average(tline.data());
+        }
+        if (m_hmag_pas[t] != nullptr) {
+            m_hmag_pas[t]->set_line_hvelmag_average(tline.data());
+        }
+    }
+}
+
+} // namespace amr_wind
@@ -0,0 +1,408 @@
+#include "amr-wind/utilities/GlobalIntegrals.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/fvm/velocity_invariants.H"
+
+#include <algorithm>
+#include <utility>
+
+namespace amr_wind {
+
+namespace {
+
+using FieldArrays = amrex::GpuArray<
+    amrex::Array4<amrex::Real const>,
+    GlobalIntegrals::max_fields>;
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE amrex::Real factor_value(
+    const GlobalIntegrals::FactorOp op,
+    const amrex::Array4<amrex::Real const>& farr,
+    const int comp,
+    const int ncomp,
+    const amrex::Real probloz,
+    const amrex::Real dz,
+    const int i,
+    const int j,
+    const int k)
+{
+    switch (op) {
+    case GlobalIntegrals::FactorOp::MagSq: {
+        amrex::Real val = 0.0;
+        for (int n = 0; n < ncomp; ++n) {
+            val += farr(i, j, k, n) * farr(i, j, k, n);
+        }
+        return val;
+    }
+    case GlobalIntegrals::FactorOp::VorticityMagSq: {
+        const amrex::Real vort = fvm::invariants::VorticityMag{}(farr, i, j, k);
+        return vort * vort;
+    }
+    case GlobalIntegrals::FactorOp::LiquidHeight: {
+        // Crude model of liquid height in multiphase cells
+        const bool up = farr(i, j, k + 1) > farr(i, j, k);
+        const amrex::Real kk = up ? k + 1 : k;
+        const amrex::Real dir = up ? -1.0 : 1.0;
+        return probloz + (kk + dir * 0.5 * farr(i, j, k)) * dz;
+    }
+    default:
+        return farr(i, j, k, comp);
+    }
+}
+
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE amrex::Real term_value(
+    const GlobalIntegrals::Term& term,
+    const FieldArrays& farrs,
+    const amrex::Real probloz,
+    const amrex::Real dz,
+    const int i,
+    const int j,
+    const int k)
+{
+    amrex::Real prod = 1.0;
+    for (int d = 0; d < term.nfactors; ++d) {
+        prod *= factor_value(
+            term.op[d], farrs[term.fld[d]], term.comp[d], term.ncomp[d],
+            probloz, dz, i, j, k);
+    }
+    return prod;
+}
+
+/** Accumulate the integrals of a group of integrands over all levels
+ *
+ *  \param repo Field repository holding the fine-covered masks
+ *  \param geom Geometry of all levels
+ *  \param terms Integrands, the factors index into `sources`
+ *  \param sources Arrays accessed by the integrands (at most `max_fields`)
+ *  \param sums Local (not reduced across ranks) integrals
+ */
+void sum_terms(
+    const FieldRepo& repo,
+    const amrex::Vector<amrex::Geometry>& geom,
+    const amrex::Vector<GlobalIntegrals::Term>& terms,
+    const amrex::Vector<const Field*>& sources,
+    amrex::Vector<amrex::Real>& sums)
+{
+    const int nterms = static_cast<int>(terms.size());
+    const int nfields = static_cast<int>(sources.size());
+    AMREX_ALWAYS_ASSERT(nfields <= GlobalIntegrals::max_fields);
+
+#ifdef AMREX_USE_GPU
+    amrex::Gpu::DeviceVector<GlobalIntegrals::Term> dterms(nterms);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, terms.begin(), terms.end(), dterms.begin());
+    const GlobalIntegrals::Term* d_terms = dterms.data();
+#endif
+
+    const int nlevels = repo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& mask = repo.fine_mask(lev);
+        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
+                                     geom[lev].CellSize()[1] *
+                                     geom[lev].CellSize()[2];
+        const amrex::Real dz = geom[lev].CellSize()[2];
+        const amrex::Real probloz = geom[lev].ProbLo()[2];
+
+#ifdef AMREX_USE_GPU
+        amrex::Gpu::DeviceVector<amrex::Real> dsums(nterms, 0.0);
+        amrex::Real* d_sums = dsums.data();
+        for (amrex::MFIter mfi(mask); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& mask_arr = mask.const_array(mfi);
+            FieldArrays farrs;
+            for (int f = 0; f < nfields; ++f) {
+                if (sources[f] != nullptr) {
+                    farrs[f] = (*sources[f])(lev).const_array(mfi);
+                }
+            }
+
+            amrex::ParallelFor(
+                amrex::Gpu::KernelInfo().setReduction(true), bx,
+                [=] AMREX_GPU_DEVICE(
+                    int i, int j, int k,
+                    amrex::Gpu::Handler const& handler) noexcept {
+                    for (int t = 0; t < nterms; ++t) {
+                        const GlobalIntegrals::Term& term = d_terms[t];
+                        const amrex::Real wt =
+                            term.masked ? cell_vol * mask_arr(i, j, k)
+                                        : cell_vol;
+                        amrex::Gpu::deviceReduceSum(
+                            &d_sums[t],
+                            wt * term_value(
+                                     term, farrs, probloz, dz, i, j, k),
+                            handler);
+                    }
+                });
+        }
+        amrex::Vector<amrex::Real> lsums(nterms, 0.0);
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, dsums.begin(), dsums.end(),
+            lsums.begin());
+        for (int t = 0; t < nterms; ++t) {
+            sums[t] += lsums[t];
+        }
+#else
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            amrex::Vector<amrex::Real> lsums(nterms, 0.0);
+            for (amrex::MFIter mfi(mask, amrex::TilingIfNotGPU());
+                 mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.tilebox();
+                const auto& mask_arr = mask.const_array(mfi);
+                FieldArrays farrs;
+                for (int f = 0; f < nfields; ++f) {
+                    if (sources[f] != nullptr) {
+                        farrs[f] = (*sources[f])(lev).const_array(mfi);
+                    }
+                }
+
+                for (int t = 0; t < nterms; ++t) {
+                    const GlobalIntegrals::Term& term = terms[t];
+                    amrex::Real tsum = 0.0;
+                    amrex::Loop(bx, [=, &tsum](int i, int j, int k) noexcept {
+                        const amrex::Real wt =
+                            term.masked ? cell_vol * mask_arr(i, j, k)
+                                        : cell_vol;
+                        tsum +=
+                            wt * term_value(term, farrs, probloz, dz, i, j, k);
+                    });
+                    lsums[t] += tsum;
+                }
+            }
+#ifdef _OPENMP
+#pragma omp critical(amr_wind_global_integrals)
+#endif
+            for (int t = 0; t < nterms; ++t) {
+                sums[t] += lsums[t];
+            }
+        }
+#endif
+    }
+}
+
+} // namespace
+
+GlobalIntegrals::GlobalIntegrals(CFDSim& sim) : m_sim(sim) {}
+
+GlobalIntegrals::~GlobalIntegrals() = default;
+
+int GlobalIntegrals::field_index(const Field& field, const bool gradient) const
+{
+    const int nfields = static_cast<int>(m_fields.size());
+    for (int f = 0; f < nfields; ++f) {
+        if ((m_fields[f] == &field) &&
+            (m_use_gradient[f] == static_cast<int>(gradient))) {
+            return f;
+        }
+    }
+    return -1;
+}
+
+int GlobalIntegrals::register_field(const Field& field, const bool gradient)
+{
+    AMREX_ALWAYS_ASSERT(field.field_location() == FieldLoc::CELL);
+
+    const int fidx = field_index(field, gradient);
+    if (fidx > -1) {
+        return fidx;
+    }
+
+    const int nfields = static_cast<int>(m_fields.size());
+    m_fields.push_back(&field);
+    m_use_gradient.push_back(static_cast<int>(gradient));
+    m_versions.push_back(0);
+    return nfields;
+}
+
+int GlobalIntegrals::find_group(const amrex::Vector<int>& fields)
+{
+    // First group with enough free slots for the arrays that it is missing
+    const int ngroups = static_cast<int>(m_groups.size());
+    for (int g = 0; g < ngroups; ++g) {
+        const auto& gfields = m_groups[g];
+        amrex::Vector<int> missing;
+        for (const int f : fields) {
+            if ((std::find(gfields.begin(), gfields.end(), f) ==
+                 gfields.end()) &&
+                (std::find(missing.begin(), missing.end(), f) ==
+                 missing.end())) {
+                missing.push_back(f);
+            }
+        }
+        if (static_cast<int>(gfields.size() + missing.size()) <= max_fields) {
+            return g;
+        }
+    }
+
+    m_groups.emplace_back();
+    return ngroups;
+}
+
+int GlobalIntegrals::group_slot(const int group, const int field)
+{
+    auto& gfields = m_groups[group];
+    const auto it = std::find(gfields.begin(), gfields.end(), field);
+    if (it != gfields.end()) {
+        return static_cast<int>(it - gfields.begin());
+    }
+    AMREX_ALWAYS_ASSERT(static_cast<int>(gfields.size()) < max_fields);
+    gfields.push_back(field);
+    return static_cast<int>(gfields.size()) - 1;
+}
+
+int GlobalIntegrals::add_integrand(
+    const amrex::Vector<Factor>& factors,
+    const amrex::Real coeff,
+    const bool masked,
+    const int frequency)
+{
+    const int nfactors = static_cast<int>(factors.size());
+    AMREX_ALWAYS_ASSERT(nfactors > 0 && nfactors <= max_factors);
+
+    Term term;
+    amrex::Vector<int> fields(nfactors);
+    term.nfactors = nfactors;
+    term.masked = masked;
+    for (int d = 0; d < nfactors; ++d) {
+        const auto& fac = factors[d];
+        AMREX_ALWAYS_ASSERT(fac.field != nullptr);
+        const bool gradient = (fac.op == FactorOp::VorticityMagSq);
+        if (gradient) {
+            AMREX_ALWAYS_ASSERT(fac.field->num_comp() == AMREX_SPACEDIM);
+        }
+        if (fac.op == FactorOp::LiquidHeight) {
+            AMREX_ALWAYS_ASSERT(fac.field->num_grow()[2] > 0);
+        }
+        AMREX_ALWAYS_ASSERT(fac.comp >= 0 && fac.comp < fac.field->num_comp());
+
+        fields[d] = register_field(*fac.field, gradient);
+        term.op[d] = fac.op;
+        term.comp[d] = fac.comp;
+        term.ncomp[d] = fac.field->num_comp();
+    }
+
+    // The factors index into the arrays of the group evaluated together
+    const int group = find_group(fields);
+    for (int d = 0; d < nfactors; ++d) {
+        term.fld[d] = group_slot(group, fields[d]);
+    }
+
+    m_terms.push_back(term);
+    m_term_group.push_back(group);
+    m_coeffs.push_back(coeff);
+    m_freqs.push_back(frequency);
+    m_values.push_back(0.0);
+    m_evaluated.push_back(0);
+    return static_cast<int>(m_terms.size()) - 1;
+}
+
+bool GlobalIntegrals::data_changed() const
+{
+    if (m_eval_time_index != m_sim.time().time_index()) {
+        return true;
+    }
+
+    const int nfields = static_cast<int>(m_fields.size());
+    for (int f = 0; f < nfields; ++f) {
+        if (m_versions[f] != m_fields[f]->data_version()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GlobalIntegrals::is_stale(const int idx) const
+{
+    return (m_evaluated[idx] == 0) || data_changed();
+}
+
+amrex::Real GlobalIntegrals::value(const int idx)
+{
+    AMREX_ALWAYS_ASSERT(idx >= 0 && idx < num_integrands());
+    if (is_stale(idx)) {
+        evaluate(idx);
+    }
+    return m_values[idx];
+}
+
+const amrex::iMultiFab& GlobalIntegrals::fine_mask(const int lev) const
+{
+    return m_sim.repo().fine_mask(lev);
+}
+
+void GlobalIntegrals::evaluate(const int idx)
+{
+    BL_PROFILE("amr-wind::GlobalIntegrals::evaluate");
+
+    // Integrands evaluated together: the requested one and those due at
+    // this timestep that do not already have a value for the current data
+    const int tidx = m_sim.time().time_index();
+    const int nterms_all = num_integrands();
+    if (data_changed()) {
+        std::fill(m_evaluated.begin(), m_evaluated.end(), 0);
+    }
+    amrex::Vector<int> active;
+    amrex::Vector<Term> terms;
+    for (int t = 0; t < nterms_all; ++t) {
+        const bool due = (m_freqs[t] > 0) && (tidx % m_freqs[t] == 0);
+        if ((t == idx) || (due && (m_evaluated[t] == 0))) {
+            m_evaluated[t] = 1;
+            active.push_back(t);
+            terms.push_back(m_terms[t]);
+        }
+    }
+    const int nterms = static_cast<int>(terms.size());
+
+    // Record the data used by this evaluation
+    const int nfields = static_cast<int>(m_fields.size());
+    for (int f = 0; f < nfields; ++f) {
+        m_versions[f] = m_fields[f]->data_version();
+    }
+
+    // One sweep per group of integrands, the gradients are only computed if
+    // needed
+    amrex::Vector<amrex::Real> sums(nterms, 0.0);
+    const int ngroups = static_cast<int>(m_groups.size());
+    for (int g = 0; g < ngroups; ++g) {
+        amrex::Vector<Term> gterms;
+        amrex::Vector<int> gpos;
+        for (int n = 0; n < nterms; ++n) {
+            if (m_term_group[active[n]] == g) {
+                gterms.push_back(terms[n]);
+                gpos.push_back(n);
+            }
+        }
+        if (gterms.empty()) {
+            continue;
+        }
+
+        const auto& gfields = m_groups[g];
+        amrex::Vector<const Field*> sources(gfields.size(), nullptr);
+        for (const auto& term : gterms) {
+            for (int d = 0; d < term.nfactors; ++d) {
+                const int f = gfields[term.fld[d]];
+                sources[term.fld[d]] =
+                    (m_use_gradient[f] != 0)
+                        ? &m_fields[f]->repo().cached_gradient(*m_fields[f])
+                        : m_fields[f];
+            }
+        }
+
+        amrex::Vector<amrex::Real> gsums(gterms.size(), 0.0);
+        sum_terms(m_sim.repo(), m_sim.mesh().Geom(), gterms, sources, gsums);
+        for (int n = 0; n < static_cast<int>(gpos.size()); ++n) {
+            sums[gpos[n]] = gsums[n];
+        }
+    }
+
+    amrex::ParallelDescriptor::ReduceRealSum(sums.data(), nterms);
+
+    for (int n = 0; n < nterms; ++n) {
+        const int t = active[n];
+        m_values[t] = m_coeffs[t] * sums[n];
+    }
+    m_eval_time_index = tidx;
+    ++m_num_evals;
+}
+
+} // namespace amr_wind
@@ -1,8 +1,10 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_REAL.H>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #include <fstream>
+#include <iomanip>
 
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/CFDSim.H"
@@ -22,11 +24,75 @@
 
 namespace amr_wind {
 
+namespace {
+
+//! Cells of a level intersecting a region of the physical domain
+amrex::Box region_box(const amrex::Geometry& geom, const amrex::RealBox& rbx)
+{
+    const auto& problo = geom.ProbLoArray();
+    const auto& dxinv = geom.InvCellSizeArray();
+    amrex::IntVect lo, hi;
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        lo[dir] = static_cast<int>(
+            std::floor((rbx.lo(dir) - problo[dir]) * dxinv[dir]));
+        hi[dir] = static_cast<int>(
+                      std::ceil((rbx.hi(dir) - problo[dir]) * dxinv[dir])) -
+                  1;
+    }
+    return amrex::Box(lo, hi) & geom.Domain();
+}
+
+/** Copy data into all the replicas of its domain in a single communication
+ *
+ *  The boxes of `src` are replicated with the shifts of all replicas and
+ *  assigned to the rank that owns the original box, so the replicated data
+ *  is assembled locally before one ParallelCopy into `dst`.
+ */
+void replicate_copy(
+    amrex::MultiFab& dst,
+    const amrex::MultiFab& src,
+    const amrex::Vector<amrex::IntVect>& shifts)
+{
+    const auto& src_ba = src.boxArray();
+    const auto& src_pmap = src.DistributionMap().ProcessorMap();
+    const int nboxes = static_cast<int>(src_ba.size());
+
+    amrex::BoxList blist(src_ba.ixType());
+    amrex::Vector<int> pmap;
+    for (const auto& shift : shifts) {
+        for (int n = 0; n < nboxes; ++n) {
+            blist.push_back(amrex::shift(src_ba[n], shift));
+            pmap.push_back(src_pmap[n]);
+        }
+    }
+    amrex::BoxArray rep_ba(std::move(blist));
+    amrex::DistributionMapping rep_dm(std::move(pmap));
+
+    const int ncomp = src.nComp();
+    amrex::MultiFab rep_src(rep_ba, rep_dm, ncomp, 0);
+    for (amrex::MFIter mfi(rep_src); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const amrex::IntVect shift = shifts[mfi.index() / nboxes];
+        const auto& sarr = src.const_array(mfi.index() % nboxes);
+        const auto& darr = rep_src.array(mfi);
+        amrex::ParallelFor(
+            bx, ncomp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                darr(i, j, k, n) =
+                    sarr(i - shift[0], j - shift[1], k - shift[2], n);
+            });
+    }
+
+    dst.ParallelCopy(rep_src);
+}
+
+} // namespace
+
 IOManager::IOManager(CFDSim& sim)
     : m_sim(sim), m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
 {}
 
-IOManager::~IOManager() = default;
+IOManager::~IOManager() { fence_checkpoints(); }
 
 void IOManager::initialize_io()
 {
@@ -44,6 +110,12 @@ void IOManager::initialize_io()
     pp.query("check_file", m_chk_prefix);
     pp.query("restart_file", m_restart_file);
     pp.query("allow_missing_restart_fields", m_allow_missing_restart_fields);
+    pp.query("async_checkpoint", m_async_checkpoint);
+    pp.query("async_checkpoint_max_pending", m_max_pending_chk);
+    if (m_max_pending_chk < 1) {
+        amrex::Abort(
+            "IOManager: io.async_checkpoint_max_pending must be at least 1");
+    }
 #ifdef AMR_WIND_USE_HDF5
     pp.query("output_hdf5_plotfile", m_output_hdf5_plotfile);
 #ifdef AMR_WIND_USE_HDF5_ZFP
@@ -122,6 +194,97 @@ void IOManager::initialize_io()
         auto& fld = repo.get_field(fname);
         m_chk_fields.emplace_back(&fld);
     }
+
+    amrex::Vector<std::string> profiles;
+    pp.queryarr("output_profiles", profiles);
+    for (const auto& pname : profiles) {
+        m_profiles.push_back(read_output_profile(pname));
+    }
+}
+
+IOManager::OutputProfile IOManager::read_output_profile(const std::string& name)
+{
+    OutputProfile prof;
+    prof.name = name;
+    prof.prefix = m_plt_prefix + "_" + name;
+
+    amrex::ParmParse pp("io." + name);
+    pp.query("plot_file", prof.prefix);
+    pp.get("output_frequency", prof.out_freq);
+    pp.query("max_level", prof.max_level);
+    pp.query("stride", prof.stride);
+    pp.query("float32", prof.float32);
+
+    amrex::Vector<amrex::Real> roi_lo;
+    amrex::Vector<amrex::Real> roi_hi;
+    pp.queryarr("roi_lo", roi_lo);
+    pp.queryarr("roi_hi", roi_hi);
+    prof.use_roi = !roi_lo.empty() || !roi_hi.empty();
+    if (prof.use_roi) {
+        AMREX_ALWAYS_ASSERT(roi_lo.size() == AMREX_SPACEDIM);
+        AMREX_ALWAYS_ASSERT(roi_hi.size() == AMREX_SPACEDIM);
+        prof.roi = amrex::RealBox(roi_lo.data(), roi_hi.data());
+    }
+
+    if (prof.out_freq < 1) {
+        amrex::Abort(
+            "IOManager: output_frequency must be positive for output profile " +
+            name);
+    }
+    if (prof.stride < 1) {
+        amrex::Abort(
+            "IOManager: stride must be positive for output profile " + name);
+    }
+    // Averaging requires boxes that can be coarsened by the stride
+    const auto& mesh = m_sim.mesh();
+    for (int lev = 0; lev <= mesh.maxLevel(); ++lev) {
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            if (mesh.blockingFactor(lev)[dir] % prof.stride != 0) {
+                amrex::Abort(
+                    "IOManager: stride must divide the blocking factor for "
+                    "output profile " +
+                    name);
+            }
+        }
+    }
+
+    // Default to the variables of the full plot file
+    amrex::Vector<std::string> out_vars;
+    amrex::Vector<std::string> out_int_vars;
+    pp.queryarr("outputs", out_vars);
+    pp.queryarr("int_outputs", out_int_vars);
+    auto& repo = m_sim.repo();
+    if (out_vars.empty() && out_int_vars.empty()) {
+        prof.fields = m_plt_fields;
+        prof.int_fields = m_int_plt_fields;
+    }
+    for (const auto& fname : out_vars) {
+        if (repo.field_exists(fname)) {
+            prof.fields.emplace_back(&repo.get_field(fname));
+        } else {
+            amrex::Print() << "  Invalid output variable requested: " << fname
+                           << std::endl;
+        }
+    }
+    for (const auto& fname : out_int_vars) {
+        if (repo.int_field_exists(fname)) {
+            prof.int_fields.emplace_back(&repo.get_int_field(fname));
+        } else {
+            amrex::Print() << "  Invalid output variable requested: " << fname
+                           << std::endl;
+        }
+    }
+
+    for (const auto* fld : prof.fields) {
+        prof.num_comp += fld->num_comp();
+        ioutils::add_var_names(prof.var_names, fld->name(), fld->num_comp());
+    }
+    for (const auto* fld : prof.int_fields) {
+        prof.num_comp += fld->num_comp();
+        ioutils::add_var_names(prof.var_names, fld->name(), fld->num_comp());
+    }
+
+    return prof;
 }
 
 void IOManager::write_plot_file()
@@ -181,6 +344,101 @@ void IOManager::write_plot_file()
 #endif
 }
 
+void IOManager::write_output_profiles()
+{
+    const int tidx = m_sim.time().time_index();
+    for (const auto& prof : m_profiles) {
+        if (tidx % prof.out_freq == 0) {
+            write_output_profile(prof);
+        }
+    }
+}
+
+void IOManager::write_output_profile(const OutputProfile& prof)
+{
+    BL_PROFILE("amr-wind::IOManager::write_output_profile");
+
+    const auto& mesh = m_sim.mesh();
+    const int ncomp = prof.num_comp;
+    const amrex::IntVect stride(prof.stride);
+    int nlevels = m_sim.repo().num_active_levels();
+    if (prof.max_level >= 0) {
+        nlevels = amrex::min(nlevels, prof.max_level + 1);
+    }
+
+    amrex::Vector<amrex::MultiFab> outdata;
+    amrex::Vector<amrex::Geometry> geoms;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab mf(
+            mesh.boxArray(lev), mesh.DistributionMap(lev), ncomp, 0);
+        int icomp = 0;
+        for (auto* fld : prof.fields) {
+            amrex::MultiFab::Copy(
+                mf, (*fld)(lev), 0, icomp, fld->num_comp(), 0);
+            icomp += fld->num_comp();
+        }
+        for (auto* fld : prof.int_fields) {
+            amrex::MultiFab::Copy(
+                mf, amrex::ToMultiFab((*fld)(lev)), 0, icomp, fld->num_comp(),
+                0);
+            icomp += fld->num_comp();
+        }
+
+        // Subsample by averaging the cells within each stride
+        auto geom = mesh.Geom(lev);
+        if (prof.stride > 1) {
+            geom = amrex::coarsen(geom, stride);
+            amrex::MultiFab crse(
+                amrex::coarsen(mf.boxArray(), stride), mf.DistributionMap(),
+                ncomp, 0);
+            amrex::average_down(mf, crse, 0, ncomp, stride);
+            mf = std::move(crse);
+        }
+
+        // Only keep the boxes intersecting the region of interest, the output
+        // stops at the first level that does not intersect it
+        if (prof.use_roi) {
+            const auto ba =
+                amrex::intersect(mf.boxArray(), region_box(geom, prof.roi));
+            if (ba.empty()) {
+                break;
+            }
+            amrex::MultiFab roi(ba, amrex::DistributionMapping(ba), ncomp, 0);
+            roi.ParallelCopy(mf);
+            mf = std::move(roi);
+        }
+
+        outdata.push_back(std::move(mf));
+        geoms.push_back(geom);
+    }
+
+    const int nout = static_cast<int>(outdata.size());
+    if (nout == 0) {
+        return;
+    }
+    amrex::Vector<const amrex::MultiFab*> outptrs(nout);
+    for (int lev = 0; lev < nout; ++lev) {
+        outptrs[lev] = &outdata[lev];
+    }
+    amrex::Vector<int> istep(nout, m_sim.time().time_index());
+
+    const std::string& plt_filename =
+        amrex::Concatenate(prof.prefix, m_sim.time().time_index());
+    amrex::Print() << "Writing plot file       " << plt_filename << " at time "
+                   << m_sim.time().new_time() << std::endl;
+
+    // The precision of native plot files is set by the FAB output format
+    const auto fab_format = amrex::FArrayBox::getFormat();
+    if (prof.float32) {
+        amrex::FArrayBox::setFormat(amrex::FABio::FAB_NATIVE_32);
+    }
+    amrex::WriteMultiLevelPlotfile(
+        plt_filename, nout, outptrs, prof.var_names, geoms,
+        m_sim.time().new_time(), istep, mesh.refRatio());
+    amrex::FArrayBox::setFormat(fab_format);
+    write_info_file(plt_filename);
+}
+
 void IOManager::write_checkpoint_file(const int start_level)
 {
     BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
@@ -188,6 +446,16 @@ void IOManager::write_checkpoint_file(const int start_level)
     const std::string chkname =
         amrex::Concatenate(m_chk_prefix, m_sim.time().time_index());
 
+    // Make room for this checkpoint and never write into a directory that is
+    // still being written
+    if (m_async_checkpoint) {
+        bool overlap = false;
+        for (const auto& chk : m_pending_chk) {
+            overlap = overlap || (chk.name == chkname);
+        }
+        wait_checkpoints(overlap ? 0 : m_max_pending_chk - 1);
+    }
+
     amrex::Print() << "Writing checkpoint file " << chkname << " at time "
                    << m_sim.time().new_time() << std::endl;
     const auto& mesh = m_sim.mesh();
@@ -196,14 +464,53 @@ void IOManager::write_checkpoint_file(const int start_level)
     write_header(chkname, start_level);
     write_info_file(chkname);
 
+    if (!m_async_checkpoint) {
+        for (int lev = start_level; lev < mesh.finestLevel() + 1; ++lev) {
+            for (auto* fld : m_chk_fields) {
+                auto& field = *fld;
+                amrex::VisMF::Write(
+                    field(lev), amrex::MultiFabFileFullPrefix(
+                                    lev - start_level, chkname, level_prefix,
+                                    field.name()));
+            }
+        }
+        return;
+    }
+
+    // Snapshot the fields so that the solution can be advanced while the
+    // staging buffers are written by the background I/O thread
+    PendingCheckpoint chk;
+    chk.name = chkname;
     for (int lev = start_level; lev < mesh.finestLevel() + 1; ++lev) {
         for (auto* fld : m_chk_fields) {
-            auto& field = *fld;
-            amrex::VisMF::Write(
-                field(lev),
+            const auto& mfab = (*fld)(lev);
+            amrex::MultiFab staged(
+                mfab.boxArray(), mfab.DistributionMap(), mfab.nComp(),
+                mfab.nGrowVect());
+            amrex::MultiFab::Copy(
+                staged, mfab, 0, 0, mfab.nComp(), mfab.nGrowVect());
+            chk.writes.push_back(amrex::VisMF::AsyncWrite(
+                std::move(staged),
                 amrex::MultiFabFileFullPrefix(
-                    lev - start_level, chkname, level_prefix, field.name()));
+                    lev - start_level, chkname, level_prefix, fld->name())));
+        }
+    }
+    m_pending_chk.push_back(std::move(chk));
+}
+
+void IOManager::wait_checkpoints(const int max_pending)
+{
+    if (num_pending_checkpoints() <= max_pending) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::IOManager::wait_checkpoints");
+    while (num_pending_checkpoints() > max_pending) {
+        auto& chk = m_pending_chk.front();
+        for (auto& status : chk.writes) {
+            status.wait();
         }
+        m_pending_chk.pop_front();
     }
 }
 
@@ -223,9 +530,29 @@ void IOManager::read_checkpoint_fields(
     // always use the level 0 domain
     amrex::Box orig_domain(ba_chk[0].minimalBox());
 
+    // Time spent reading each field
+    amrex::Vector<amrex::Real> read_times(m_chk_fields.size(), 0.0);
+
     for (int lev = 0; lev < nlevels; ++lev) {
-        for (auto* fld : m_chk_fields) {
-            auto& field = *fld;
+        // Shifts of all the replicas of the checkpoint domain at this level
+        amrex::Vector<amrex::IntVect> shifts;
+        for (int k = 0; k < rep[2]; k++) {
+            for (int j = 0; j < rep[1]; j++) {
+                for (int i = 0; i < rep[0]; i++) {
+                    amrex::IntVect shift_vec(
+                        i * orig_domain.length(0), j * orig_domain.length(1),
+                        k * orig_domain.length(2));
+
+                    // equivalent to 2^lev
+                    shift_vec *= (1 << lev);
+                    shifts.push_back(shift_vec);
+                }
+            }
+        }
+
+        for (int ifld = 0; ifld < m_chk_fields.size(); ++ifld) {
+            const amrex::Real tstart = amrex::ParallelDescriptor::second();
+            auto& field = *m_chk_fields[ifld];
             const auto& fab_file = amrex::MultiFabFileFullPrefix(
                 lev, restart_file, level_prefix, field.name());
 
@@ -252,30 +579,24 @@ void IOManager::read_checkpoint_fields(
                     tmp, amrex::MultiFabFileFullPrefix(
                              lev, restart_file, level_prefix, field.name()));
 
-                for (int k = 0; k < rep[2]; k++) {
-                    for (int j = 0; j < rep[1]; j++) {
-                        for (int i = 0; i < rep[0]; i++) {
-
-                            amrex::IntVect shift_vec(
-                                i * orig_domain.length(0),
-                                j * orig_domain.length(1),
-                                k * orig_domain.length(2));
-
-                            // equivalent to 2^lev
-                            shift_vec *= (1 << lev);
-
-                            tmp.shift(shift_vec);
-                            mfab.ParallelCopy(tmp);
-                            tmp.shift(-shift_vec);
-                        }
-                    }
-                }
+                replicate_copy(mfab, tmp, shifts);
 
                 mfab.setBndry(0.0);
             }
+            read_times[ifld] += amrex::ParallelDescriptor::second() - tstart;
         }
     }
 
+    amrex::ParallelDescriptor::ReduceRealMax(
+        read_times.data(), static_cast<int>(read_times.size()),
+        amrex::ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "Restart field read times (s):" << std::endl;
+    for (int ifld = 0; ifld < m_chk_fields.size(); ++ifld) {
+        amrex::Print() << "  " << std::setw(24) << std::left
+                       << m_chk_fields[ifld]->name() << std::right << " "
+                       << read_times[ifld] << std::endl;
+    }
+
     // If fields were missing, print diagnostic message.
     if (!missing.empty()) {
         amrex::Print() << "\nWARNING: The following fields were missing in the "
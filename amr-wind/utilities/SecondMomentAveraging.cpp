@@ -7,7 +7,7 @@ void SecondMomentAveraging::output_line_average_ascii(
 {
     BL_PROFILE("amr-wind::SecondMomentAveraging::output_line_average_ascii");
 
-    if (step != m_last_updated_index) {
+    if (step != m_engine.last_updated_index()) {
         operator()();
     }
 
@@ -46,6 +46,7 @@ void SecondMomentAveraging::output_line_average_ascii(
 
     const int ncomp1 = m_plane_average1.ncomp();
     const int ncomp2 = m_plane_average2.ncomp();
+    const auto& moments = m_engine.line_moment(m_term);
 
     for (int i = 0; i < m_plane_average1.ncell_line(); ++i) {
         outfile << step << ", " << std::scientific << time << ", "
@@ -53,8 +54,7 @@ void SecondMomentAveraging::output_line_average_ascii(
         for (int m = 0; m < ncomp1; ++m) {
             for (int n = 0; n < ncomp2; ++n) {
                 outfile << ", " << std::scientific
-                        << m_second_moments_line
-                               [m_num_moments * i + ncomp2 * m + n];
+                        << moments[m_num_moments * i + ncomp2 * m + n];
             }
         }
 
@@ -72,137 +72,26 @@ void SecondMomentAveraging::output_line_average_ascii(
 
 SecondMomentAveraging::SecondMomentAveraging(
     FieldPlaneAveraging& pa1, FieldPlaneAveraging& pa2)
-    : m_plane_average1(pa1), m_plane_average2(pa2)
+    : m_owned_engine(std::make_unique<FusedPlaneAveraging>())
+    , m_engine(*m_owned_engine)
+    , m_plane_average1(pa1)
+    , m_plane_average2(pa2)
 {
-
-    AMREX_ALWAYS_ASSERT(m_plane_average1.axis() == m_plane_average2.axis());
-    AMREX_ALWAYS_ASSERT(m_plane_average1.level() == m_plane_average2.level());
-    AMREX_ALWAYS_ASSERT(
-        m_plane_average1.ncell_plane() == m_plane_average2.ncell_plane());
-    AMREX_ALWAYS_ASSERT(
-        m_plane_average1.ncell_line() == m_plane_average2.ncell_line());
-
-    m_num_moments = m_plane_average1.ncomp() * m_plane_average2.ncomp();
-
-    m_second_moments_line.resize(
-        static_cast<size_t>(m_plane_average1.ncell_line()) * m_num_moments,
-        0.0);
+    m_term = m_engine.add_moment({&m_plane_average1, &m_plane_average2});
+    m_num_moments = m_engine.num_moments(m_term);
 }
 
-void SecondMomentAveraging::operator()()
+SecondMomentAveraging::SecondMomentAveraging(
+    FusedPlaneAveraging& engine,
+    FieldPlaneAveraging& pa1,
+    FieldPlaneAveraging& pa2)
+    : m_engine(engine), m_plane_average1(pa1), m_plane_average2(pa2)
 {
-
-    m_last_updated_index = m_plane_average1.last_updated_index();
-
-    std::fill(m_second_moments_line.begin(), m_second_moments_line.end(), 0.0);
-
-    const auto& field1 = m_plane_average1.field();
-    const auto& field2 = m_plane_average2.field();
-
-    const int level = m_plane_average1.level();
-
-    switch (m_plane_average1.axis()) {
-    case 0:
-        compute_average(XDir(), field1(level), field2(level));
-        break;
-    case 1:
-        compute_average(YDir(), field1(level), field2(level));
-        break;
-    case 2:
-        compute_average(ZDir(), field1(level), field2(level));
-        break;
-    default:
-        amrex::Abort("axis must be equal to 0, 1, or 2");
-        break;
-    }
+    m_term = m_engine.add_moment({&m_plane_average1, &m_plane_average2});
+    m_num_moments = m_engine.num_moments(m_term);
 }
 
-template <typename IndexSelector>
-void SecondMomentAveraging::compute_average(
-    const IndexSelector& idxOp,
-    const amrex::MultiFab& mfab1,
-    const amrex::MultiFab& mfab2)
-{
-
-    BL_PROFILE("amr-wind::SecondMomentAveraging::compute_average");
-
-    amrex::AsyncArray<amrex::Real> lfluc(
-        m_second_moments_line.data(), m_second_moments_line.size());
-    amrex::Real* line_fluc = lfluc.data();
-
-    amrex::AsyncArray<amrex::Real> lavg1(
-        m_plane_average1.line_average().data(),
-        m_plane_average1.line_average().size());
-    amrex::AsyncArray<amrex::Real> lavg2(
-        m_plane_average2.line_average().data(),
-        m_plane_average2.line_average().size());
-
-    amrex::Real* line_avg1 = lavg1.data();
-    amrex::Real* line_avg2 = lavg2.data();
-
-    amrex::Real denom = 1.0 / (amrex::Real)m_plane_average1.ncell_plane();
-
-    const int ncomp1 = m_plane_average1.ncomp();
-    const int ncomp2 = m_plane_average2.ncomp();
-    const int nmoments = m_num_moments;
-
-#ifdef _OPENMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-    for (amrex::MFIter mfi(mfab1, amrex::TilingIfNotGPU()); mfi.isValid();
-         ++mfi) {
-        amrex::Box bx = mfi.tilebox();
-
-        auto mfab_arr1 = mfab1.const_array(mfi);
-        auto mfab_arr2 = mfab2.const_array(mfi);
-
-        amrex::Box pbx =
-            PerpendicularBox<IndexSelector>(bx, amrex::IntVect{0, 0, 0});
-
-        amrex::ParallelFor(
-            amrex::Gpu::KernelInfo().setReduction(true), pbx,
-            [=] AMREX_GPU_DEVICE(
-                int p_i, int p_j, int p_k,
-                amrex::Gpu::Handler const& handler) noexcept {
-                // Loop over the direction perpendicular to the plane.
-                // This reduces the atomic pressure on the destination arrays.
-
-                amrex::Box lbx = ParallelBox<IndexSelector>(
-                    bx, amrex::IntVect{p_i, p_j, p_k});
-
-                for (int k = lbx.smallEnd(2); k <= lbx.bigEnd(2); ++k) {
-                    for (int j = lbx.smallEnd(1); j <= lbx.bigEnd(1); ++j) {
-                        for (int i = lbx.smallEnd(0); i <= lbx.bigEnd(0); ++i) {
-
-                            const int ind = idxOp(i, j, k);
-
-                            int nf = 0;
-                            for (int m = 0; m < ncomp1; ++m) {
-                                const amrex::Real up1 =
-                                    mfab_arr1(i, j, k, m) -
-                                    line_avg1[ncomp1 * ind + m];
-                                for (int n = 0; n < ncomp2; ++n) {
-                                    const amrex::Real up2 =
-                                        mfab_arr2(i, j, k, n) -
-                                        line_avg2[ncomp2 * ind + n];
-
-                                    amrex::Gpu::deviceReduceSum(
-                                        &line_fluc[nmoments * ind + nf],
-                                        up1 * up2 * denom, handler);
-                                    ++nf;
-                                }
-                            }
-                        }
-                    }
-                }
-            });
-    }
-
-    lfluc.copyToHost(
-        m_second_moments_line.data(), m_second_moments_line.size());
-    amrex::ParallelDescriptor::ReduceRealSum(
-        m_second_moments_line.data(), m_second_moments_line.size());
-}
+void SecondMomentAveraging::operator()() { m_engine(); }
 
 amrex::Real SecondMomentAveraging::line_average_interpolated(
     amrex::Real x, int comp1, int comp2) const
@@ -226,6 +115,7 @@ SecondMomentAveraging::line_average_interpolated(amrex::Real x, int comp) const
     const amrex::Real dx = m_plane_average1.dx();
     const amrex::Real xlo = m_plane_average1.xlo();
     const int ncell_line = m_plane_average1.ncell_line();
+    const auto& moments = m_engine.line_moment(m_term);
 
     amrex::Real c = 0.0;
     int ind = 0;
@@ -243,8 +133,8 @@ SecondMomentAveraging::line_average_interpolated(amrex::Real x, int comp) const
 
     AMREX_ALWAYS_ASSERT(ind >= 0 and ind + 1 < ncell_line);
 
-    return m_second_moments_line[m_num_moments * ind + comp] * (1.0 - c) +
-           m_second_moments_line[m_num_moments * (ind + 1) + comp] * c;
+    return moments[m_num_moments * ind + comp] * (1.0 - c) +
+           moments[m_num_moments * (ind + 1) + comp] * c;
 }
 
 amrex::Real SecondMomentAveraging::line_average_cell(int ind, int comp) const
@@ -254,7 +144,8 @@ amrex::Real SecondMomentAveraging::line_average_cell(int ind, int comp) const
     AMREX_ALWAYS_ASSERT(comp >= 0 && comp < m_num_moments);
     AMREX_ALWAYS_ASSERT(ind >= 0 and ind + 1 < m_plane_average1.ncell_line());
 
-    return m_second_moments_line[m_num_moments * ind + comp];
+    const auto& moments = m_engine.line_moment(m_term);
+    return moments[m_num_moments * ind + comp];
 }
 
 amrex::Real
@@ -277,8 +168,9 @@ void SecondMomentAveraging::line_moment(
     AMREX_ALWAYS_ASSERT(comp >= 0 && comp < m_num_moments);
 
     const int ncell_line = m_plane_average1.ncell_line();
+    const auto& moments = m_engine.line_moment(m_term);
     for (int i = 0; i < ncell_line; i++) {
-        l_vec[i] = m_second_moments_line[m_num_moments * i + comp];
+        l_vec[i] = moments[m_num_moments * i + comp];
     }
 }
 
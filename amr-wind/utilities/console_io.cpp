@@ -162,10 +162,14 @@ void print_mlmg_header(const std::string& key)
                    << std::endl;
 }
 
-void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
+void print_mlmg_info(
+    const std::string& solve_name,
+    const amrex::MLMG& mlmg,
+    const bool warm_start)
 {
     const int name_width = 26;
-    amrex::Print() << "  " << std::setw(name_width) << std::left << solve_name
+    const std::string name = warm_start ? solve_name + "(ws)" : solve_name;
+    amrex::Print() << "  " << std::setw(name_width) << std::left << name
                    << std::setw(6) << std::right << mlmg.getNumIters()
                    << std::setw(22) << std::right << mlmg.getInitResidual()
                    << std::setw(22) << std::right << mlmg.getFinalResidual()
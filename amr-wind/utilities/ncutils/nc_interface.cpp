@@ -1,4 +1,5 @@
 #include <cstdio>
+#include <mutex>
 
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
@@ -12,6 +13,21 @@ namespace {
 
 char recname[NC_MAX_NAME + 1];
 
+/** Process-wide lock serializing all calls into the NetCDF library
+ *
+ *  NetCDF is not thread-safe, and the name buffer above is shared, so every
+ *  wrapper holds this lock when files are accessed from multiple threads
+ *  (e.g., background readers). The lock is recursive since wrappers call each
+ *  other.
+ */
+std::recursive_mutex& nc_mutex()
+{
+    static std::recursive_mutex mtx;
+    return mtx;
+}
+
+using NCLock = std::lock_guard<std::recursive_mutex>;
+
 void check_nc_error(int ierr)
 {
     if (ierr != NC_NOERR) {
@@ -23,12 +39,14 @@ void check_nc_error(int ierr)
 
 std::string NCDim::name() const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_inq_dimname(ncid, dimid, recname));
     return std::string(recname);
 }
 
 size_t NCDim::len() const
 {
+    NCLock lock(nc_mutex());
     size_t dlen;
     check_nc_error(nc_inq_dimlen(ncid, dimid, &dlen));
     return dlen;
@@ -36,12 +54,14 @@ size_t NCDim::len() const
 
 std::string NCVar::name() const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_inq_varname(ncid, varid, recname));
     return std::string(recname);
 }
 
 int NCVar::ndim() const
 {
+    NCLock lock(nc_mutex());
     int ndims;
     check_nc_error(nc_inq_varndims(ncid, varid, &ndims));
     return ndims;
@@ -49,6 +69,7 @@ int NCVar::ndim() const
 
 std::vector<size_t> NCVar::shape() const
 {
+    NCLock lock(nc_mutex());
     int ndims = ndim();
     std::vector<int> dimids(ndims);
     std::vector<size_t> vshape(ndims);
@@ -64,16 +85,19 @@ std::vector<size_t> NCVar::shape() const
 
 void NCVar::put(const double* ptr) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_var_double(ncid, varid, ptr));
 }
 
 void NCVar::put(const float* ptr) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_var_float(ncid, varid, ptr));
 }
 
 void NCVar::put(const int* ptr) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_var_int(ncid, varid, ptr));
 }
 
@@ -82,6 +106,7 @@ void NCVar::put(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_put_vara_double(ncid, varid, start.data(), count.data(), dptr));
 }
@@ -92,6 +117,7 @@ void NCVar::put(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_vars_double(
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
@@ -101,6 +127,7 @@ void NCVar::put(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_put_vara_float(ncid, varid, start.data(), count.data(), dptr));
 }
@@ -111,6 +138,7 @@ void NCVar::put(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_vars_float(
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
@@ -120,6 +148,7 @@ void NCVar::put(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_put_vara_int(ncid, varid, start.data(), count.data(), dptr));
 }
@@ -130,22 +159,26 @@ void NCVar::put(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_vars_int(
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
 
 void NCVar::get(double* ptr) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_get_var_double(ncid, varid, ptr));
 }
 
 void NCVar::get(float* ptr) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_get_var_float(ncid, varid, ptr));
 }
 
 void NCVar::get(int* ptr) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_get_var_int(ncid, varid, ptr));
 }
 
@@ -154,6 +187,7 @@ void NCVar::get(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_get_vara_double(ncid, varid, start.data(), count.data(), dptr));
 }
@@ -164,6 +198,7 @@ void NCVar::get(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_get_vars_double(
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
@@ -173,6 +208,7 @@ void NCVar::get(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_get_vara_float(ncid, varid, start.data(), count.data(), dptr));
 }
@@ -183,6 +219,7 @@ void NCVar::get(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_get_vars_float(
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
@@ -192,6 +229,7 @@ void NCVar::get(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_get_vara_int(ncid, varid, start.data(), count.data(), dptr));
 }
@@ -202,12 +240,14 @@ void NCVar::get(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_get_vars_int(
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
 
 bool NCVar::has_attr(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int ierr;
     size_t lenp;
     ierr = nc_inq_att(ncid, varid, name.data(), NULL, &lenp);
@@ -216,6 +256,7 @@ bool NCVar::has_attr(const std::string& name) const
 
 void NCVar::put_attr(const std::string& name, const std::string& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(
         nc_put_att_text(ncid, varid, name.data(), value.size(), value.data()));
 }
@@ -223,6 +264,7 @@ void NCVar::put_attr(const std::string& name, const std::string& value) const
 void NCVar::put_attr(
     const std::string& name, const std::vector<double>& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_double(
         ncid, varid, name.data(), NC_DOUBLE, value.size(), value.data()));
 }
@@ -230,6 +272,7 @@ void NCVar::put_attr(
 void NCVar::put_attr(
     const std::string& name, const std::vector<float>& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_float(
         ncid, varid, name.data(), NC_FLOAT, value.size(), value.data()));
 }
@@ -237,12 +280,14 @@ void NCVar::put_attr(
 void NCVar::put_attr(
     const std::string& name, const std::vector<int>& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_int(
         ncid, varid, name.data(), NC_INT, value.size(), value.data()));
 }
 
 std::string NCVar::get_attr(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     std::vector<char> aval;
     check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
@@ -253,6 +298,7 @@ std::string NCVar::get_attr(const std::string& name) const
 
 void NCVar::get_attr(const std::string& name, std::vector<double>& values) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
     values.resize(lenp);
@@ -261,6 +307,7 @@ void NCVar::get_attr(const std::string& name, std::vector<double>& values) const
 
 void NCVar::get_attr(const std::string& name, std::vector<float>& values) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
     values.resize(lenp);
@@ -269,6 +316,7 @@ void NCVar::get_attr(const std::string& name, std::vector<float>& values) const
 
 void NCVar::get_attr(const std::string& name, std::vector<int>& values) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
     values.resize(lenp);
@@ -277,11 +325,13 @@ void NCVar::get_attr(const std::string& name, std::vector<int>& values) const
 
 void NCVar::par_access(const int cmode) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_var_par_access(ncid, varid, cmode));
 }
 
 std::string NCGroup::name() const
 {
+    NCLock lock(nc_mutex());
     size_t nlen;
     std::vector<char> grpname;
     check_nc_error(nc_inq_grpname_len(ncid, &nlen));
@@ -292,6 +342,7 @@ std::string NCGroup::name() const
 
 std::string NCGroup::full_name() const
 {
+    NCLock lock(nc_mutex());
     size_t nlen;
     std::vector<char> grpname;
     check_nc_error(nc_inq_grpname_full(ncid, &nlen, NULL));
@@ -302,6 +353,7 @@ std::string NCGroup::full_name() const
 
 NCGroup NCGroup::def_group(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int newid;
     check_nc_error(nc_def_grp(ncid, name.data(), &newid));
     return NCGroup(newid, this);
@@ -309,6 +361,7 @@ NCGroup NCGroup::def_group(const std::string& name) const
 
 NCGroup NCGroup::group(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int newid;
     check_nc_error(nc_inq_ncid(ncid, name.data(), &newid));
     return NCGroup(newid, this);
@@ -316,6 +369,7 @@ NCGroup NCGroup::group(const std::string& name) const
 
 NCDim NCGroup::dim(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int newid;
     check_nc_error(nc_inq_dimid(ncid, name.data(), &newid));
     return NCDim{ncid, newid};
@@ -323,6 +377,7 @@ NCDim NCGroup::dim(const std::string& name) const
 
 NCDim NCGroup::def_dim(const std::string& name, const size_t len) const
 {
+    NCLock lock(nc_mutex());
     int newid;
     check_nc_error(nc_def_dim(ncid, name.data(), len, &newid));
     return NCDim{ncid, newid};
@@ -330,6 +385,7 @@ NCDim NCGroup::def_dim(const std::string& name, const size_t len) const
 
 NCVar NCGroup::def_scalar(const std::string& name, const nc_type dtype) const
 {
+    NCLock lock(nc_mutex());
     int newid;
     check_nc_error(nc_def_var(ncid, name.data(), dtype, 0, NULL, &newid));
     return NCVar{ncid, newid};
@@ -340,6 +396,7 @@ NCVar NCGroup::def_array(
     const nc_type dtype,
     const std::vector<std::string>& dnames) const
 {
+    NCLock lock(nc_mutex());
     int newid;
     int ndims = dnames.size();
     std::vector<int> dimids(ndims);
@@ -352,6 +409,7 @@ NCVar NCGroup::def_array(
 
 NCVar NCGroup::var(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int varid;
     check_nc_error(nc_inq_varid(ncid, name.data(), &varid));
     return NCVar{ncid, varid};
@@ -359,6 +417,7 @@ NCVar NCGroup::var(const std::string& name) const
 
 int NCGroup::num_groups() const
 {
+    NCLock lock(nc_mutex());
     int ngrps;
     check_nc_error(nc_inq_grps(ncid, &ngrps, NULL));
     return ngrps;
@@ -366,6 +425,7 @@ int NCGroup::num_groups() const
 
 int NCGroup::num_dimensions() const
 {
+    NCLock lock(nc_mutex());
     int ndims;
     check_nc_error(nc_inq(ncid, &ndims, NULL, NULL, NULL));
     return ndims;
@@ -373,6 +433,7 @@ int NCGroup::num_dimensions() const
 
 int NCGroup::num_attributes() const
 {
+    NCLock lock(nc_mutex());
     int nattrs;
     check_nc_error(nc_inq(ncid, NULL, NULL, &nattrs, NULL));
     return nattrs;
@@ -380,6 +441,7 @@ int NCGroup::num_attributes() const
 
 int NCGroup::num_variables() const
 {
+    NCLock lock(nc_mutex());
     int nvars;
     check_nc_error(nc_inq(ncid, NULL, &nvars, NULL, NULL));
     return nvars;
@@ -387,24 +449,28 @@ int NCGroup::num_variables() const
 
 bool NCGroup::has_group(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int ierr = nc_inq_ncid(ncid, name.data(), NULL);
     return (ierr == NC_NOERR);
 }
 
 bool NCGroup::has_dim(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int ierr = nc_inq_dimid(ncid, name.data(), NULL);
     return (ierr == NC_NOERR);
 }
 
 bool NCGroup::has_var(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int ierr = nc_inq_varid(ncid, name.data(), NULL);
     return (ierr == NC_NOERR);
 }
 
 bool NCGroup::has_attr(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     int ierr;
     size_t lenp;
     ierr = nc_inq_att(ncid, NC_GLOBAL, name.data(), NULL, &lenp);
@@ -413,6 +479,7 @@ bool NCGroup::has_attr(const std::string& name) const
 
 void NCGroup::put_attr(const std::string& name, const std::string& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_text(
         ncid, NC_GLOBAL, name.data(), value.size(), value.data()));
 }
@@ -420,6 +487,7 @@ void NCGroup::put_attr(const std::string& name, const std::string& value) const
 void NCGroup::put_attr(
     const std::string& name, const std::vector<double>& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_double(
         ncid, NC_GLOBAL, name.data(), NC_DOUBLE, value.size(), value.data()));
 }
@@ -427,6 +495,7 @@ void NCGroup::put_attr(
 void NCGroup::put_attr(
     const std::string& name, const std::vector<float>& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_float(
         ncid, NC_GLOBAL, name.data(), NC_FLOAT, value.size(), value.data()));
 }
@@ -434,12 +503,14 @@ void NCGroup::put_attr(
 void NCGroup::put_attr(
     const std::string& name, const std::vector<int>& value) const
 {
+    NCLock lock(nc_mutex());
     check_nc_error(nc_put_att_int(
         ncid, NC_GLOBAL, name.data(), NC_INT, value.size(), value.data()));
 }
 
 std::string NCGroup::get_attr(const std::string& name) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     std::vector<char> aval;
     check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
@@ -451,6 +522,7 @@ std::string NCGroup::get_attr(const std::string& name) const
 void NCGroup::get_attr(
     const std::string& name, std::vector<double>& values) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
     values.resize(lenp);
@@ -461,6 +533,7 @@ void NCGroup::get_attr(
 void NCGroup::get_attr(
     const std::string& name, std::vector<float>& values) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
     values.resize(lenp);
@@ -470,6 +543,7 @@ void NCGroup::get_attr(
 
 void NCGroup::get_attr(const std::string& name, std::vector<int>& values) const
 {
+    NCLock lock(nc_mutex());
     size_t lenp;
     check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
     values.resize(lenp);
@@ -478,6 +552,7 @@ void NCGroup::get_attr(const std::string& name, std::vector<int>& values) const
 
 std::vector<NCGroup> NCGroup::all_groups() const
 {
+    NCLock lock(nc_mutex());
     std::vector<NCGroup> grps;
     int ngrps = num_groups();
 
@@ -493,6 +568,7 @@ std::vector<NCGroup> NCGroup::all_groups() const
 
 std::vector<NCDim> NCGroup::all_dims() const
 {
+    NCLock lock(nc_mutex());
     std::vector<NCDim> adims;
     int ndims = num_dimensions();
     adims.reserve(ndims);
@@ -504,6 +580,7 @@ std::vector<NCDim> NCGroup::all_dims() const
 
 std::vector<NCVar> NCGroup::all_vars() const
 {
+    NCLock lock(nc_mutex());
     std::vector<NCVar> avars;
     int nvars = num_variables();
     avars.reserve(nvars);
@@ -515,6 +592,7 @@ std::vector<NCVar> NCGroup::all_vars() const
 
 void NCGroup::enter_def_mode() const
 {
+    NCLock lock(nc_mutex());
     int ierr;
     ierr = nc_redef(ncid);
 
@@ -524,10 +602,15 @@ void NCGroup::enter_def_mode() const
     check_nc_error(ierr);
 }
 
-void NCGroup::exit_def_mode() const { check_nc_error(nc_enddef(ncid)); }
+void NCGroup::exit_def_mode() const
+{
+    NCLock lock(nc_mutex());
+    check_nc_error(nc_enddef(ncid));
+}
 
 NCFile NCFile::create(const std::string& name, const int cmode)
 {
+    NCLock lock(nc_mutex());
     int ncid;
     check_nc_error(nc_create(name.data(), cmode, &ncid));
     return NCFile(ncid);
@@ -535,6 +618,7 @@ NCFile NCFile::create(const std::string& name, const int cmode)
 
 NCFile NCFile::open(const std::string& name, const int cmode)
 {
+    NCLock lock(nc_mutex());
     int ncid;
     check_nc_error(nc_open(name.data(), cmode, &ncid));
     return NCFile(ncid);
@@ -543,6 +627,7 @@ NCFile NCFile::open(const std::string& name, const int cmode)
 NCFile NCFile::create_par(
     const std::string& name, const int cmode, MPI_Comm comm, MPI_Info info)
 {
+    NCLock lock(nc_mutex());
     int ncid;
     check_nc_error(nc_create_par(name.data(), cmode, comm, info, &ncid));
     return NCFile(ncid);
@@ -551,6 +636,7 @@ NCFile NCFile::create_par(
 NCFile NCFile::open_par(
     const std::string& name, const int cmode, MPI_Comm comm, MPI_Info info)
 {
+    NCLock lock(nc_mutex());
     int ncid;
     check_nc_error(nc_open_par(name.data(), cmode, comm, info, &ncid));
     return NCFile(ncid);
@@ -558,11 +644,19 @@ NCFile NCFile::open_par(
 
 NCFile::~NCFile()
 {
+    NCLock lock(nc_mutex());
     if (is_open) check_nc_error(nc_close(ncid));
 }
 
+void NCFile::sync() const
+{
+    NCLock lock(nc_mutex());
+    check_nc_error(nc_sync(ncid));
+}
+
 void NCFile::close()
 {
+    NCLock lock(nc_mutex());
     is_open = false;
     check_nc_error(nc_close(ncid));
 }
@@ -1,11 +1,10 @@
 #include "amr-wind/utilities/sampling/Enstrophy.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
-#include <AMReX_MultiFabUtil.H>
 #include <utility>
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/IOManager.H"
-#include "amr-wind/fvm/vorticity_mag.H"
+#include "amr-wind/utilities/GlobalIntegrals.H"
 
 namespace amr_wind {
 namespace enstrophy {
@@ -25,66 +24,21 @@ void Enstrophy::initialize()
     amrex::ParmParse pp(m_label);
     pp.query("output_frequency", m_out_freq);
 
+    // Mass weighted average over the domain
+    using Factor = GlobalIntegrals::Factor;
+    const amrex::Real total_vol = m_sim.mesh().Geom(0).ProbDomain().volume();
+    m_integral_idx = m_sim.integrals().add_integrand(
+        {Factor{&m_density},
+         Factor{&m_velocity, GlobalIntegrals::FactorOp::VorticityMagSq}},
+        0.5 / total_vol, true, m_out_freq);
+
     prepare_ascii_file();
 }
 
 amrex::Real Enstrophy::calculate_enstrophy()
 {
     BL_PROFILE("amr-wind::Enstrophy::calculate_enstrophy");
-
-    // integrated total Enstrophy
-    amrex::Real total_enstrophy = 0.0;
-
-    const int finest_level = m_velocity.repo().num_active_levels() - 1;
-    const auto& geom = m_velocity.repo().mesh().Geom();
-
-    auto vorticity = amr_wind::fvm::vorticity_mag(m_velocity);
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        total_enstrophy += amrex::ReduceSum(
-            m_density(lev), (*vorticity)(lev), level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& den_arr,
-                amrex::Array4<amrex::Real const> const& vort_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real enstrophy_fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &enstrophy_fab](int i, int j, int k) noexcept {
-                        enstrophy_fab +=
-                            cell_vol * mask_arr(i, j, k) * den_arr(i, j, k) *
-                            (vort_arr(i, j, k) * vort_arr(i, j, k));
-                    });
-                return enstrophy_fab;
-            });
-    }
-
-    // total volume of grid on level 0
-    const amrex::Real total_vol = geom[0].ProbDomain().volume();
-
-    total_enstrophy *= 0.5 / total_vol;
-
-    amrex::ParallelDescriptor::ReduceRealSum(total_enstrophy);
-
-    return total_enstrophy;
+    return m_sim.integrals().value(m_integral_idx);
 }
 
 void Enstrophy::post_advance_work()
@@ -5,6 +5,7 @@
 #include <utility>
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/GlobalIntegrals.H"
 
 namespace amr_wind {
 namespace field_norms {
@@ -31,6 +32,25 @@ void FieldNorms::initialize()
 
     m_fnorms.resize(m_var_names.size(), 0.0);
 
+    // Cell-centered fields are integrated together with the other global
+    // integrals, the remaining fields are reduced individually
+    using Factor = GlobalIntegrals::Factor;
+    using FactorOp = GlobalIntegrals::FactorOp;
+    auto& integrals = m_sim.integrals();
+    const amrex::Real total_vol = m_sim.mesh().Geom(0).ProbDomain().volume();
+    for (const auto* fld : io_mng.plot_fields()) {
+        for (int comp = 0; comp < fld->num_comp(); ++comp) {
+            const amrex::Vector<Factor> factors{
+                Factor{fld, FactorOp::Comp, comp},
+                Factor{fld, FactorOp::Comp, comp}};
+            const bool fused = (fld->field_location() == FieldLoc::CELL);
+            m_integral_idx.push_back(
+                fused ? integrals.add_integrand(
+                            factors, 1.0 / total_vol, false, m_out_freq)
+                      : -1);
+        }
+    }
+
     prepare_ascii_file();
 }
 
@@ -75,10 +95,13 @@ amrex::Real FieldNorms::L2_norm(amr_wind::Field& field, const int comp)
 
 void FieldNorms::process_field_norms()
 {
+    auto& integrals = m_sim.integrals();
     int ind = 0;
     for (const auto& fld : m_sim.io_manager().plot_fields()) {
-        for (int comp = 0; comp < fld->num_comp(); ++comp) {
-            m_fnorms[ind++] = L2_norm(*fld, comp);
+        for (int comp = 0; comp < fld->num_comp(); ++comp, ++ind) {
+            const int idx = m_integral_idx[ind];
+            m_fnorms[ind] = (idx > -1) ? std::sqrt(integrals.value(idx))
+                                       : L2_norm(*fld, comp);
         }
     }
 }
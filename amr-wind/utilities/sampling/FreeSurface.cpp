@@ -9,6 +9,193 @@
 namespace amr_wind {
 namespace free_surface {
 
+namespace {
+
+/** Check if the cell column at `iv` contains the 2D sampling point `loc`
+ *
+ *  The half-open interval avoids double-counting points that lie on cell
+ *  faces, with an exception for points on the lower domain boundary.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE bool column_contains_point(
+    const amrex::IntVect& iv,
+    const amrex::GpuArray<amrex::Real, 2>& loc,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& plo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const int gc1,
+    const int gc2)
+{
+    const amrex::Real xm1 = plo[gc1] + (iv[gc1] + 0.5) * dx[gc1];
+    const amrex::Real xm2 = plo[gc2] + (iv[gc2] + 0.5) * dx[gc2];
+    return ((plo[gc1] == loc[0] && xm1 - loc[0] == 0.5 * dx[gc1]) ||
+            (xm1 - loc[0] < 0.5 * dx[gc1] && loc[0] - xm1 <= 0.5 * dx[gc1])) &&
+           ((plo[gc2] == loc[1] && xm2 - loc[1] == 0.5 * dx[gc2]) ||
+            (xm2 - loc[1] < 0.5 * dx[gc2] && loc[1] - xm2 <= 0.5 * dx[gc2]));
+}
+
+/** Location of the vof = 0.5 isosurface along the search direction in a cell
+ *
+ *  Returns the lower domain bound when the cell is above the height `hprev`
+ *  found by the previous instance, or when no interface can be detected.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real interface_height(
+    const int i,
+    const int j,
+    const int k,
+    const amrex::GpuArray<amrex::Real, 2>& loc,
+    const amrex::Real hprev,
+    const amrex::Array4<amrex::Real const>& vof_arr,
+    const int dir,
+    const int gc1,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& plo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxi)
+{
+    // Initialize height measurement
+    amrex::Real ht = plo[dir];
+    // Cell location
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
+    xm[0] = plo[0] + (i + 0.5) * dx[0];
+    xm[1] = plo[1] + (j + 0.5) * dx[1];
+    xm[2] = plo[2] + (k + 0.5) * dx[2];
+    int ip = static_cast<int>(dir == 0);
+    const int im = i - ip;
+    ip = i + ip;
+    int jp = static_cast<int>(dir == 1);
+    const int jm = j - jp;
+    jp = j + jp;
+    int kp = static_cast<int>(dir == 2);
+    const int km = k - kp;
+    kp = k + kp;
+    // (1) Check that cell height is below previous instance. (2) Check if
+    // cell is obviously multiphase, then check if cell might have interface
+    // at top or bottom
+    if (!((hprev > xm[dir] + 0.5 * dx[dir]) &&
+          ((vof_arr(i, j, k) < (1.0 - 1e-12) && vof_arr(i, j, k) > 1e-12) ||
+           (vof_arr(i, j, k) < 1e-12 &&
+            (vof_arr(ip, jp, kp) > (1.0 - 1e-12) ||
+             vof_arr(im, jm, km) > (1.0 - 1e-12)))))) {
+        return ht;
+    }
+
+    // Interpolate in x and y for the current cell and the ones above and
+    // below
+    amrex::Real wx_hi = 0.0;
+    amrex::Real wy_hi = 0.0;
+    amrex::Real wz_hi = 0.0;
+    int iup = i;
+    int idn = i;
+    int jup = j;
+    int jdn = j;
+    int kup = k;
+    int kdn = k;
+
+    // Determine which cells to use for grid
+    if (dir != 0) {
+        // If x is a grid coord, it is always first (e.g., xy or xz)
+        int li = 0;
+        if (loc[li] < xm[0]) {
+            iup = i;
+            idn = i - 1;
+            wx_hi = (loc[li] - (xm[0] - dx[0])) * dxi[0];
+        } else {
+            iup = i + 1;
+            idn = i;
+            wx_hi = (loc[li] - xm[0]) * dxi[0];
+        }
+    }
+    if (dir != 1) {
+        // y can be first or second (xy, yz)
+        int li = (gc1 == 1 ? 0 : 1);
+        if (loc[li] < xm[1]) {
+            jup = j;
+            jdn = j - 1;
+            wy_hi = (loc[li] - (xm[1] - dx[1])) * dxi[1];
+        } else {
+            jup = j + 1;
+            jdn = j;
+            wy_hi = (loc[li] - xm[1]) * dxi[1];
+        }
+    }
+    if (dir != 2) {
+        // If z is a grid coord, it is always second (e.g., yz or xz)
+        int li = 1;
+        if (loc[li] < xm[2]) {
+            kup = k;
+            kdn = k - 1;
+            wz_hi = (loc[li] - (xm[2] - dx[2])) * dxi[2];
+        } else {
+            kup = k + 1;
+            kdn = k;
+            wz_hi = (loc[li] - xm[2]) * dxi[2];
+        }
+    }
+    const amrex::Real wx_lo = 1.0 - wx_hi;
+    const amrex::Real wy_lo = 1.0 - wy_hi;
+    const amrex::Real wz_lo = 1.0 - wz_hi;
+
+    amrex::Real vof_above = 0.0;
+    amrex::Real vof_below = 0.0;
+    amrex::Real vof_here = 0.0;
+
+    if (dir == 0) {
+        vof_above = wz_lo * wy_lo * vof_arr(i + 1, jdn, kdn) +
+                    wz_lo * wy_hi * vof_arr(i + 1, jup, kdn) +
+                    wz_hi * wy_lo * vof_arr(i + 1, jdn, kup) +
+                    wz_hi * wy_hi * vof_arr(i + 1, jup, kup);
+        vof_here = wz_lo * wy_lo * vof_arr(i, jdn, kdn) +
+                   wz_lo * wy_hi * vof_arr(i, jup, kdn) +
+                   wz_hi * wy_lo * vof_arr(i, jdn, kup) +
+                   wz_hi * wy_hi * vof_arr(i, jup, kup);
+        vof_below = wz_lo * wy_lo * vof_arr(i - 1, jdn, kdn) +
+                    wz_lo * wy_hi * vof_arr(i - 1, jup, kdn) +
+                    wz_hi * wy_lo * vof_arr(i - 1, jdn, kup) +
+                    wz_hi * wy_hi * vof_arr(i - 1, jup, kup);
+    }
+    if (dir == 1) {
+        vof_above = wx_lo * wz_lo * vof_arr(idn, j + 1, kdn) +
+                    wx_lo * wz_hi * vof_arr(idn, j + 1, kup) +
+                    wx_hi * wz_lo * vof_arr(iup, j + 1, kdn) +
+                    wx_hi * wz_hi * vof_arr(iup, j + 1, kup);
+        vof_here = wx_lo * wz_lo * vof_arr(idn, j, kdn) +
+                   wx_lo * wz_hi * vof_arr(idn, j, kup) +
+                   wx_hi * wz_lo * vof_arr(iup, j, kdn) +
+                   wx_hi * wz_hi * vof_arr(iup, j, kup);
+        vof_below = wx_lo * wz_lo * vof_arr(idn, j - 1, kdn) +
+                    wx_lo * wz_hi * vof_arr(idn, j - 1, kup) +
+                    wx_hi * wz_lo * vof_arr(iup, j - 1, kdn) +
+                    wx_hi * wz_hi * vof_arr(iup, j - 1, kup);
+    }
+    if (dir == 2) {
+        vof_above = wx_lo * wy_lo * vof_arr(idn, jdn, k + 1) +
+                    wx_lo * wy_hi * vof_arr(idn, jup, k + 1) +
+                    wx_hi * wy_lo * vof_arr(iup, jdn, k + 1) +
+                    wx_hi * wy_hi * vof_arr(iup, jup, k + 1);
+        vof_here = wx_lo * wy_lo * vof_arr(idn, jdn, k) +
+                   wx_lo * wy_hi * vof_arr(idn, jup, k) +
+                   wx_hi * wy_lo * vof_arr(iup, jdn, k) +
+                   wx_hi * wy_hi * vof_arr(iup, jup, k);
+        vof_below = wx_lo * wy_lo * vof_arr(idn, jdn, k - 1) +
+                    wx_lo * wy_hi * vof_arr(idn, jup, k - 1) +
+                    wx_hi * wy_lo * vof_arr(iup, jdn, k - 1) +
+                    wx_hi * wy_hi * vof_arr(iup, jup, k - 1);
+    }
+    // Determine which cell to interpolate with
+    const bool above = (vof_above - 0.5) * (vof_here - 0.5) <= 0.0;
+    const bool below = (vof_below - 0.5) * (vof_here - 0.5) <= 0.0;
+    if (above) {
+        // Interpolate positive direction
+        ht = xm[dir] + (dx[dir]) / (vof_above - vof_here) * (0.5 - vof_here);
+    } else if (below) {
+        // Interpolate negative direction
+        ht = xm[dir] - (dx[dir]) / (vof_below - vof_here) * (0.5 - vof_here);
+    }
+    // If none satisfy requirement, then the isosurface vof = 0.5 cannot be
+    // detected in the search direction
+    return ht;
+}
+
+} // namespace
+
 FreeSurface::FreeSurface(CFDSim& sim, std::string label)
     : m_sim(sim), m_label(std::move(label)), m_vof(sim.repo().get_field("vof"))
 {
@@ -91,6 +278,12 @@ void FreeSurface::initialize()
         }
     }
 
+    // Device copy of the locations for the height search
+    m_dlocs.resize(2 * m_npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, &m_locs[0][0], &m_locs[0][0] + 2 * m_npts,
+        m_dlocs.begin());
+
     if (m_out_fmt == "netcdf") {
         prepare_netcdf_file();
     }
@@ -107,331 +300,117 @@ void FreeSurface::post_advance_work()
         return;
     }
 
-    // Zero data in output array
-    for (int n = 0; n < m_npts * m_ninst; n++) {
-        m_out[n] = 0.0;
-    }
     // Set up device vector of outputs, initialize to above phi0
     const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
     const auto& phi0 = m_sim.mesh().Geom(0).ProbHiArray();
     amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, phi0[2] + 1.0);
-    auto* dout_ptr = dout.data();
+    const auto* dout_ptr = dout.data();
+    const auto* dlocs_ptr = m_dlocs.data();
+
+    // Spacing of the 2D sampling grid, used to find the points in a column
+    const amrex::GpuArray<int, 2> npts_dir{m_npts_dir[0], m_npts_dir[1]};
+    const amrex::GpuArray<amrex::Real, 2> gstart{
+        m_start[m_gc1], m_start[m_gc2]};
+    const amrex::GpuArray<amrex::Real, 2> gdx{
+        (m_end[m_gc1] - m_start[m_gc1]) / amrex::max(m_npts_dir[0] - 1, 1),
+        (m_end[m_gc2] - m_start[m_gc2]) / amrex::max(m_npts_dir[1] - 1, 1)};
 
-    // Sum of interface locations at each point (assumes one interface only)
     const int finest_level = m_vof.repo().num_active_levels() - 1;
+    const int dir = m_coorddir;
+    const int gc1 = m_gc1;
+    const int gc2 = m_gc2;
 
-    // Loop instances
+    // Loop instances, each one searches below the previous one
     for (int ni = 0; ni < m_ninst; ++ni) {
+        // Heights of this instance, accumulated over all levels
+        amrex::Gpu::DeviceVector<amrex::Real> dheight(m_npts, 0.0);
+        auto* dht_ptr = dheight.data();
+
         for (int lev = 0; lev <= finest_level; lev++) {
 
             // Use level_mask to identify smallest volume
-            amrex::iMultiFab level_mask;
-            if (lev < finest_level) {
-                level_mask = makeFineMask(
-                    m_sim.mesh().boxArray(lev),
-                    m_sim.mesh().DistributionMap(lev),
-                    m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-            } else {
-                level_mask.define(
-                    m_sim.mesh().boxArray(lev),
-                    m_sim.mesh().DistributionMap(lev), 1, 0, amrex::MFInfo());
-                level_mask.setVal(1);
-            }
+            const auto& level_mask = m_sim.repo().fine_mask(lev);
 
             const auto& vof = m_vof(lev);
             const auto& geom = m_sim.mesh().Geom(lev);
-            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
-                geom.CellSizeArray();
-            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dxi =
-                geom.InvCellSizeArray();
-            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
-                geom.ProbLoArray();
-
-            const int captured_m_coorddir = m_coorddir;
-            const int captured_m_gc1 = m_gc1;
-            const int captured_m_gc2 = m_gc2;
-
-            // Loop points in 2D grid
-            for (int n = 0; n < m_npts; ++n) {
-                amrex::GpuArray<amrex::Real, 2> loc;
-                for (int d = 0; d < 2; ++d) {
-                    loc[d] = m_locs[n][d];
-                }
-
-                m_out[ni * m_npts + n] = amrex::max(
-                    m_out[ni * m_npts + n],
-                    amrex::ReduceMax(
-                        vof, level_mask, 0,
-                        [=] AMREX_GPU_HOST_DEVICE(
-                            amrex::Box const& bx,
-                            amrex::Array4<amrex::Real const> const& vof_arr,
-                            amrex::Array4<int const> const& mask_arr)
-                            -> amrex::Real {
-                            amrex::Real height_fab = 0.0;
-
-                            amrex::Loop(
-                                bx,
-                                [=, &height_fab](int i, int j, int k) noexcept {
-                                    // Initialize height measurement
-                                    amrex::Real ht = plo[captured_m_coorddir];
-                                    // Cell location
-                                    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>
-                                        xm;
-                                    xm[0] = plo[0] + (i + 0.5) * dx[0];
-                                    xm[1] = plo[1] + (j + 0.5) * dx[1];
-                                    xm[2] = plo[2] + (k + 0.5) * dx[2];
-                                    int ip = static_cast<int>(
-                                        captured_m_coorddir == 0);
-                                    const int im = i - ip;
-                                    ip = i + ip;
-                                    int jp = static_cast<int>(
-                                        captured_m_coorddir == 1);
-                                    const int jm = j - jp;
-                                    jp = j + jp;
-                                    int kp = static_cast<int>(
-                                        captured_m_coorddir == 2);
-                                    const int km = k - kp;
-                                    kp = k + kp;
-                                    // (1) Check that cell height is below
-                                    // previous instance. (2) Check if cell
-                                    // contains 2D grid point: complicated
-                                    // conditional is to avoid double-counting
-                                    // and includes exception for lo boundary.
-                                    // (3) Check if cell is obviously
-                                    // multiphase, then check if cell might have
-                                    // interface at top or bottom
-                                    if ((dout_ptr[n] >
-                                         xm[captured_m_coorddir] +
-                                             0.5 * dx[captured_m_coorddir]) &&
-                                        (((plo[captured_m_gc1] == loc[0] &&
-                                           xm[captured_m_gc1] - loc[0] ==
-                                               0.5 * dx[captured_m_gc1]) ||
-                                          (xm[captured_m_gc1] - loc[0] <
-                                               0.5 * dx[captured_m_gc1] &&
-                                           loc[0] - xm[captured_m_gc1] <=
-                                               0.5 * dx[captured_m_gc1])) &&
-                                         ((plo[captured_m_gc2] == loc[1] &&
-                                           xm[captured_m_gc2] - loc[1] ==
-                                               0.5 * dx[captured_m_gc2]) ||
-                                          (xm[captured_m_gc2] - loc[1] <
-                                               0.5 * dx[captured_m_gc2] &&
-                                           loc[1] - xm[captured_m_gc2] <=
-                                               0.5 * dx[captured_m_gc2]))) &&
-                                        ((vof_arr(i, j, k) < (1.0 - 1e-12) &&
-                                          vof_arr(i, j, k) > 1e-12) ||
-                                         (vof_arr(i, j, k) < 1e-12 &&
-                                          (vof_arr(ip, jp, kp) >
-                                               (1.0 - 1e-12) ||
-                                           vof_arr(im, jm, km) >
-                                               (1.0 - 1e-12))))) {
-                                        // Interpolate in x and y for the
-                                        // current cell and the ones above and
-                                        // below
-                                        amrex::Real wx_hi = 0.0;
-                                        amrex::Real wy_hi = 0.0;
-                                        amrex::Real wz_hi = 0.0;
-                                        int iup = i;
-                                        int idn = i;
-                                        int jup = j;
-                                        int jdn = j;
-                                        int kup = k;
-                                        int kdn = k;
-
-                                        // Determine which cells to use for grid
-                                        if (captured_m_coorddir != 0) {
-                                            // If x is a grid coord, it is
-                                            // always first (e.g., xy or xz)
-                                            int li = 0;
-                                            if (loc[li] < xm[0]) {
-                                                iup = i;
-                                                idn = i - 1;
-                                                wx_hi = (loc[li] -
-                                                         (xm[0] - dx[0])) *
-                                                        dxi[0];
-                                            } else {
-                                                iup = i + 1;
-                                                idn = i;
-                                                wx_hi =
-                                                    (loc[li] - xm[0]) * dxi[0];
-                                            }
-                                        }
-                                        if (captured_m_coorddir != 1) {
-                                            // y can be first or second (xy, yz)
-                                            int li =
-                                                (captured_m_gc1 == 1 ? 0 : 1);
-                                            if (loc[li] < xm[1]) {
-                                                jup = j;
-                                                jdn = j - 1;
-                                                wy_hi = (loc[li] -
-                                                         (xm[1] - dx[1])) *
-                                                        dxi[1];
-                                            } else {
-                                                jup = j + 1;
-                                                jdn = j;
-                                                wy_hi =
-                                                    (loc[li] - xm[1]) * dxi[1];
-                                            }
-                                        }
-                                        if (captured_m_coorddir != 2) {
-                                            // If z is a grid coord, it is
-                                            // always second (e.g., yz or xz)
-                                            int li = 1;
-                                            if (loc[li] < xm[2]) {
-                                                kup = k;
-                                                kdn = k - 1;
-                                                wz_hi = (loc[li] -
-                                                         (xm[2] - dx[2])) *
-                                                        dxi[2];
-                                            } else {
-                                                kup = k + 1;
-                                                kdn = k;
-                                                wz_hi =
-                                                    (loc[li] - xm[2]) * dxi[2];
-                                            }
-                                        }
-                                        const amrex::Real wx_lo = 1.0 - wx_hi;
-                                        const amrex::Real wy_lo = 1.0 - wy_hi;
-                                        const amrex::Real wz_lo = 1.0 - wz_hi;
-
-                                        amrex::Real vof_above = 0.0;
-                                        amrex::Real vof_below = 0.0;
-                                        amrex::Real vof_here = 0.0;
-
-                                        if (captured_m_coorddir == 0) {
-                                            vof_above =
-                                                wz_lo * wy_lo *
-                                                    vof_arr(i + 1, jdn, kdn) +
-                                                wz_lo * wy_hi *
-                                                    vof_arr(i + 1, jup, kdn) +
-                                                wz_hi * wy_lo *
-                                                    vof_arr(i + 1, jdn, kup) +
-                                                wz_hi * wy_hi *
-                                                    vof_arr(i + 1, jup, kup);
-                                            vof_here =
-                                                wz_lo * wy_lo *
-                                                    vof_arr(i, jdn, kdn) +
-                                                wz_lo * wy_hi *
-                                                    vof_arr(i, jup, kdn) +
-                                                wz_hi * wy_lo *
-                                                    vof_arr(i, jdn, kup) +
-                                                wz_hi * wy_hi *
-                                                    vof_arr(i, jup, kup);
-                                            vof_below =
-                                                wz_lo * wy_lo *
-                                                    vof_arr(i - 1, jdn, kdn) +
-                                                wz_lo * wy_hi *
-                                                    vof_arr(i - 1, jup, kdn) +
-                                                wz_hi * wy_lo *
-                                                    vof_arr(i - 1, jdn, kup) +
-                                                wz_hi * wy_hi *
-                                                    vof_arr(i - 1, jup, kup);
-                                        }
-                                        if (captured_m_coorddir == 1) {
-                                            vof_above =
-                                                wx_lo * wz_lo *
-                                                    vof_arr(idn, j + 1, kdn) +
-                                                wx_lo * wz_hi *
-                                                    vof_arr(idn, j + 1, kup) +
-                                                wx_hi * wz_lo *
-                                                    vof_arr(iup, j + 1, kdn) +
-                                                wx_hi * wz_hi *
-                                                    vof_arr(iup, j + 1, kup);
-                                            vof_here =
-                                                wx_lo * wz_lo *
-                                                    vof_arr(idn, j, kdn) +
-                                                wx_lo * wz_hi *
-                                                    vof_arr(idn, j, kup) +
-                                                wx_hi * wz_lo *
-                                                    vof_arr(iup, j, kdn) +
-                                                wx_hi * wz_hi *
-                                                    vof_arr(iup, j, kup);
-                                            vof_below =
-                                                wx_lo * wz_lo *
-                                                    vof_arr(idn, j - 1, kdn) +
-                                                wx_lo * wz_hi *
-                                                    vof_arr(idn, j - 1, kup) +
-                                                wx_hi * wz_lo *
-                                                    vof_arr(iup, j - 1, kdn) +
-                                                wx_hi * wz_hi *
-                                                    vof_arr(iup, j - 1, kup);
-                                        }
-                                        if (captured_m_coorddir == 2) {
-                                            vof_above =
-                                                wx_lo * wy_lo *
-                                                    vof_arr(idn, jdn, k + 1) +
-                                                wx_lo * wy_hi *
-                                                    vof_arr(idn, jup, k + 1) +
-                                                wx_hi * wy_lo *
-                                                    vof_arr(iup, jdn, k + 1) +
-                                                wx_hi * wy_hi *
-                                                    vof_arr(iup, jup, k + 1);
-                                            vof_here =
-                                                wx_lo * wy_lo *
-                                                    vof_arr(idn, jdn, k) +
-                                                wx_lo * wy_hi *
-                                                    vof_arr(idn, jup, k) +
-                                                wx_hi * wy_lo *
-                                                    vof_arr(iup, jdn, k) +
-                                                wx_hi * wy_hi *
-                                                    vof_arr(iup, jup, k);
-                                            vof_below =
-                                                wx_lo * wy_lo *
-                                                    vof_arr(idn, jdn, k - 1) +
-                                                wx_lo * wy_hi *
-                                                    vof_arr(idn, jup, k - 1) +
-                                                wx_hi * wy_lo *
-                                                    vof_arr(iup, jdn, k - 1) +
-                                                wx_hi * wy_hi *
-                                                    vof_arr(iup, jup, k - 1);
-                                        }
-                                        // Determine which cell to
-                                        // interpolate with
-                                        const bool above =
-                                            (vof_above - 0.5) *
-                                                (vof_here - 0.5) <=
-                                            0.0;
-                                        const bool below =
-                                            (vof_below - 0.5) *
-                                                (vof_here - 0.5) <=
-                                            0.0;
-                                        if (above) {
-                                            // Interpolate positive
-                                            // direction
-                                            ht = xm[captured_m_coorddir] +
-                                                 (dx[captured_m_coorddir]) /
-                                                     (vof_above - vof_here) *
-                                                     (0.5 - vof_here);
-                                        } else {
-                                            if (below) {
-                                                // Interpolate negative
-                                                // direction
-                                                ht =
-                                                    xm[captured_m_coorddir] -
-                                                    (dx[captured_m_coorddir]) /
-                                                        (vof_below - vof_here) *
-                                                        (0.5 - vof_here);
-                                            }
-                                            // If none satisfy requirement, then
-                                            // the isosurface vof = 0.5 cannot
-                                            // be detected in the z-direction
-                                        }
+            const auto dx = geom.CellSizeArray();
+            const auto dxi = geom.InvCellSizeArray();
+            const auto plo = geom.ProbLoArray();
+
+            // Atomic updates of the heights, no OpenMP threading over boxes
+            for (amrex::MFIter mfi(vof); mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.validbox();
+                const auto& vof_arr = vof.const_array(mfi);
+                const auto& mask_arr = level_mask.const_array(mfi);
+                const int col_lo = bx.smallEnd(dir);
+                const int col_hi = bx.bigEnd(dir);
+                amrex::Box col_bx = bx;
+                col_bx.setBig(dir, col_lo);
+
+                amrex::ParallelFor(
+                    col_bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        const amrex::IntVect iv0(i, j, k);
+                        // Range of sampling points that can fall within the
+                        // column, checked exactly below
+                        int plo_idx[2];
+                        int phi_idx[2];
+                        const int gcs[2] = {gc1, gc2};
+                        for (int d = 0; d < 2; ++d) {
+                            const int g = gcs[d];
+                            plo_idx[d] = 0;
+                            phi_idx[d] = npts_dir[d] - 1;
+                            if (gdx[d] > 0.0) {
+                                const amrex::Real xlo =
+                                    plo[g] + iv0[g] * dx[g] - gstart[d];
+                                plo_idx[d] = amrex::max(
+                                    plo_idx[d],
+                                    static_cast<int>(
+                                        amrex::Math::floor(xlo / gdx[d])) -
+                                        1);
+                                phi_idx[d] = amrex::min(
+                                    phi_idx[d],
+                                    static_cast<int>(amrex::Math::floor(
+                                        (xlo + dx[g]) / gdx[d])) +
+                                        1);
+                            }
+                        }
+
+                        for (int p2 = plo_idx[1]; p2 <= phi_idx[1]; ++p2) {
+                            for (int p1 = plo_idx[0]; p1 <= phi_idx[0]; ++p1) {
+                                const int n = p2 * npts_dir[0] + p1;
+                                const amrex::GpuArray<amrex::Real, 2> loc{
+                                    dlocs_ptr[2 * n], dlocs_ptr[2 * n + 1]};
+                                if (!column_contains_point(
+                                        iv0, loc, plo, dx, gc1, gc2)) {
+                                    continue;
+                                }
+
+                                amrex::Real height_col = 0.0;
+                                for (int c = col_lo; c <= col_hi; ++c) {
+                                    amrex::IntVect iv = iv0;
+                                    iv[dir] = c;
+                                    if (mask_arr(iv) == 0) {
+                                        continue;
                                     }
-                                    // Offset by removing lo and contribute to
-                                    // whole
-                                    height_fab = amrex::max(
-                                        height_fab,
-                                        mask_arr(i, j, k) *
-                                            (ht - plo[captured_m_coorddir]));
-                                });
-                            return height_fab;
-                        }));
+                                    const amrex::Real ht = interface_height(
+                                        iv[0], iv[1], iv[2], loc, dout_ptr[n],
+                                        vof_arr, dir, gc1, plo, dx, dxi);
+                                    // Offset by removing lo
+                                    height_col =
+                                        amrex::max(height_col, ht - plo[dir]);
+                                }
+                                amrex::Gpu::Atomic::Max(
+                                    &dht_ptr[n], height_col);
+                            }
+                        }
+                    });
             }
         }
 
-        // Loop points in 2D grid
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
-        }
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, dheight.begin(), dheight.end(),
+            &m_out[ni * m_npts]);
+        amrex::ParallelDescriptor::ReduceRealMax(&m_out[ni * m_npts], m_npts);
         // Add problo back to heights, making them absolute, not relative
         for (int n = 0; n < m_npts; n++) {
             m_out[ni * m_npts + n] += plo0[m_coorddir];
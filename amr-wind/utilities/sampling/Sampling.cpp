@@ -31,6 +31,9 @@ void Sampling::initialize()
         pp.getarr("fields", field_names);
         pp.query("output_frequency", m_out_freq);
         pp.query("output_format", m_out_fmt);
+        pp.query("netcdf_parallel_io", m_nc_parallel);
+        pp.query("netcdf_flush_interval", m_nc_flush_interval);
+        AMREX_ALWAYS_ASSERT(m_nc_flush_interval > 0);
     }
 
     // Process field information
@@ -86,17 +89,40 @@ void Sampling::update_container()
     // Redistribute particles to appropriate boxes/MPI ranks
     m_scontainer->Redistribute();
     m_scontainer->num_sampling_particles() = m_total_particles;
+
+    m_container_npts.resize(m_samplers.size());
+    for (int i = 0; i < m_samplers.size(); ++i) {
+        m_container_npts[i] = m_samplers[i]->num_points();
+    }
+    m_rebuild_container = false;
 }
 
 void Sampling::update_sampling_locations()
 {
     BL_PROFILE("amr-wind::Sampling::update_sampling_locations");
 
-    for (const auto& obj : m_samplers) {
+    bool has_moving = false;
+    bool npts_changed = false;
+    for (int i = 0; i < m_samplers.size(); ++i) {
+        const auto& obj = m_samplers[i];
         obj->update_sampling_locations();
+        has_moving = has_moving || obj->is_moving();
+        npts_changed =
+            npts_changed || (obj->num_points() != m_container_npts[i]);
     }
 
-    update_container();
+    if (m_rebuild_container || npts_changed) {
+        if (npts_changed) {
+            m_total_particles = 0;
+            for (const auto& obj : m_samplers) {
+                m_total_particles += obj->num_points();
+            }
+        }
+        update_container();
+    } else if (has_moving) {
+        m_scontainer->update_particle_locations(m_samplers);
+        m_scontainer->Redistribute();
+    }
 }
 
 void Sampling::post_advance_work()
@@ -121,7 +147,8 @@ void Sampling::post_regrid_actions()
 {
 
     BL_PROFILE("amr-wind::Sampling::post_regrid_actions");
-    m_scontainer->Redistribute();
+    // Defer the rebuild of the container to the next output step
+    m_rebuild_container = true;
 }
 
 void Sampling::process_output()
@@ -183,10 +210,17 @@ void Sampling::prepare_netcdf_file()
     }
     m_ncfile_name = post_dir + "/" + sname + ".nc";
 
-    // Only I/O processor handles NetCDF generation
-    if (!amrex::ParallelDescriptor::IOProcessor()) return;
-
-    auto ncf = ncutils::NCFile::create(m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
+    // Only I/O processor handles NetCDF generation, unless parallel I/O is
+    // requested in which case all ranks participate
+    if (!m_nc_parallel && !amrex::ParallelDescriptor::IOProcessor()) return;
+
+    auto ncf = m_nc_parallel
+                   ? ncutils::NCFile::create_par(
+                         m_ncfile_name, NC_CLOBBER | NC_NETCDF4 | NC_MPIIO,
+                         amrex::ParallelContext::CommunicatorSub(),
+                         MPI_INFO_NULL)
+                   : ncutils::NCFile::create(
+                         m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
     const std::string nt_name = "num_time_steps";
     const std::string npart_name = "num_points";
     const std::vector<std::string> two_dim{nt_name, npart_name};
@@ -209,6 +243,18 @@ void Sampling::prepare_netcdf_file()
     }
     ncf.exit_def_mode();
 
+    // Unlimited dimensions can only be extended with collective access
+    if (m_nc_parallel) {
+        for (const auto& var : ncf.all_vars()) {
+            var.par_access(NC_COLLECTIVE);
+        }
+        for (const auto& grp : ncf.all_groups()) {
+            for (const auto& var : grp.all_vars()) {
+                var.par_access(NC_COLLECTIVE);
+            }
+        }
+    }
+
     {
         const std::vector<size_t> start{0, 0};
         std::vector<size_t> count{0, AMREX_SPACEDIM};
@@ -223,6 +269,10 @@ void Sampling::prepare_netcdf_file()
         }
     }
 
+    if (m_nc_parallel) {
+        m_ncfile = std::make_unique<ncutils::NCFile>(std::move(ncf));
+    }
+
 #else
     amrex::Abort(
         "NetCDF support was not enabled during build time. Please recompile or "
@@ -233,6 +283,11 @@ void Sampling::prepare_netcdf_file()
 void Sampling::write_netcdf()
 {
 #ifdef AMR_WIND_USE_NETCDF
+    if (m_nc_parallel) {
+        write_netcdf_par();
+        return;
+    }
+
     std::vector<double> buf(m_total_particles * m_var_names.size(), 0.0);
     m_scontainer->populate_buffer(buf);
 
@@ -276,5 +331,131 @@ void Sampling::write_netcdf()
 #endif
 }
 
+void Sampling::write_netcdf_par()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    BL_PROFILE("amr-wind::Sampling::write_netcdf_par");
+    std::vector<int> sid;
+    std::vector<int> nid;
+    std::vector<double> buf;
+    m_scontainer->populate_local_buffer(sid, nid, buf);
+    const int nlocal = static_cast<int>(sid.size());
+    const int nvars = m_var_names.size();
+    const int nsamplers = m_samplers.size();
+
+    // The points of every sampler are split into contiguous blocks, one per
+    // rank. Each rank sends its particle data to the owners of the blocks, so
+    // that it can then write its own block with a single call per variable.
+    const int nprocs = amrex::ParallelContext::NProcsSub();
+    amrex::Vector<int> chunk(nsamplers);
+    amrex::Vector<int> blk_start(nsamplers);
+    amrex::Vector<int> blk_count(nsamplers);
+    {
+        const int iproc = amrex::ParallelContext::MyProcSub();
+        for (const auto& obj : m_samplers) {
+            const int is = obj->id();
+            const int npts = obj->num_points();
+            chunk[is] = amrex::max(1, (npts + nprocs - 1) / nprocs);
+            blk_start[is] = amrex::min(npts, iproc * chunk[is]);
+            blk_count[is] =
+                amrex::min(npts, blk_start[is] + chunk[is]) - blk_start[is];
+        }
+    }
+
+    // Each record holds the sampler ID, the point ID and the sampled values
+    const int rec_size = 2 + nvars;
+    amrex::Vector<int> send_counts(nprocs, 0);
+    amrex::Vector<int> dest(nlocal);
+    for (int ip = 0; ip < nlocal; ++ip) {
+        dest[ip] = nid[ip] / chunk[sid[ip]];
+        send_counts[dest[ip]] += rec_size;
+    }
+    amrex::Vector<int> send_offsets(nprocs + 1, 0);
+    for (int n = 0; n < nprocs; ++n) {
+        send_offsets[n + 1] = send_offsets[n] + send_counts[n];
+    }
+    amrex::Vector<double> send_buf(send_offsets[nprocs]);
+    {
+        amrex::Vector<int> pos(send_offsets.begin(), send_offsets.end() - 1);
+        for (int ip = 0; ip < nlocal; ++ip) {
+            double* rec = &send_buf[pos[dest[ip]]];
+            rec[0] = sid[ip];
+            rec[1] = nid[ip];
+            for (int iv = 0; iv < nvars; ++iv) {
+                rec[2 + iv] = buf[iv * nlocal + ip];
+            }
+            pos[dest[ip]] += rec_size;
+        }
+    }
+
+    amrex::Vector<int> recv_counts(nprocs, 0);
+    amrex::Vector<int> recv_offsets(nprocs + 1, 0);
+#ifdef AMREX_USE_MPI
+    MPI_Alltoall(
+        send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT,
+        amrex::ParallelContext::CommunicatorSub());
+#else
+    recv_counts = send_counts;
+#endif
+    for (int n = 0; n < nprocs; ++n) {
+        recv_offsets[n + 1] = recv_offsets[n] + recv_counts[n];
+    }
+    amrex::Vector<double> recv_buf(recv_offsets[nprocs]);
+#ifdef AMREX_USE_MPI
+    MPI_Alltoallv(
+        send_buf.data(), send_counts.data(), send_offsets.data(), MPI_DOUBLE,
+        recv_buf.data(), recv_counts.data(), recv_offsets.data(), MPI_DOUBLE,
+        amrex::ParallelContext::CommunicatorSub());
+#else
+    recv_buf = send_buf;
+#endif
+
+    // Gather the received values into the local block of each sampler,
+    // stored variable by variable
+    amrex::Vector<amrex::Vector<double>> blk_data(nsamplers);
+    for (int is = 0; is < nsamplers; ++is) {
+        blk_data[is].resize(static_cast<size_t>(nvars) * blk_count[is], 0.0);
+    }
+    const int nrecv = static_cast<int>(recv_buf.size()) / rec_size;
+    for (int ir = 0; ir < nrecv; ++ir) {
+        const double* rec = &recv_buf[ir * rec_size];
+        const auto is = static_cast<int>(rec[0]);
+        const auto ii = static_cast<int>(rec[1]) - blk_start[is];
+        for (int iv = 0; iv < nvars; ++iv) {
+            blk_data[is][iv * blk_count[is] + ii] = rec[2 + iv];
+        }
+    }
+
+    auto& ncf = *m_ncfile;
+    const std::string nt_name = "num_time_steps";
+    // Index of the next timestep
+    const size_t nt = ncf.dim(nt_name).len();
+    {
+        auto time = m_sim.time().new_time();
+        ncf.var("time").put(&time, {nt}, {1});
+    }
+
+    for (const auto& obj : m_samplers) {
+        auto grp = ncf.group(obj->label());
+        obj->output_netcdf_data(grp, nt);
+    }
+
+    for (int iv = 0; iv < nvars; ++iv) {
+        for (const auto& obj : m_samplers) {
+            const int is = obj->id();
+            const auto start = static_cast<size_t>(blk_start[is]);
+            const auto count = static_cast<size_t>(blk_count[is]);
+            auto var = ncf.group(obj->label()).var(m_var_names[iv]);
+            var.put(blk_data[is].data() + iv * count, {nt, start}, {1, count});
+        }
+    }
+
+    ++m_nc_num_writes;
+    if (m_nc_num_writes % m_nc_flush_interval == 0) {
+        ncf.sync();
+    }
+#endif
+}
+
 } // namespace sampling
 } // namespace amr_wind
@@ -2,6 +2,7 @@
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
 #include "amr-wind/utilities/sampling/SamplerBase.H"
 #include "amr-wind/core/Field.H"
+#include "amr-wind/core/gpu_utils.H"
 
 namespace amr_wind {
 namespace sampling {
@@ -153,6 +154,66 @@ void SamplingContainer::initialize_particles(
     AMREX_ALWAYS_ASSERT(pidx == num_particles);
 }
 
+void SamplingContainer::update_particle_locations(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::update_particle_locations");
+
+    // Gather the locations of all moving samplers into a single array, with
+    // offsets indexed by the sampler identifier (-1 for static samplers)
+    int num_sets = 0;
+    for (const auto& probe : samplers) {
+        num_sets = amrex::max(num_sets, probe->id() + 1);
+    }
+    amrex::Vector<int> offsets(num_sets, -1);
+    amrex::Vector<amrex::Real> pos;
+    SamplerBase::SampleLocType locs;
+    for (const auto& probe : samplers) {
+        if (!probe->is_moving()) {
+            continue;
+        }
+        probe->sampling_locations(locs);
+        const int npts = probe->num_points();
+        offsets[probe->id()] = static_cast<int>(pos.size()) / AMREX_SPACEDIM;
+        for (int ip = 0; ip < npts; ++ip) {
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                pos.push_back(locs[ip][n]);
+            }
+        }
+    }
+
+    if (pos.empty()) {
+        return;
+    }
+
+    const auto doffsets = gpu::device_view(offsets);
+    const auto dpos = gpu::device_view(pos);
+    const auto* off_ptr = doffsets.data();
+    const auto* pos_ptr = dpos.data();
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                auto& pp = pstruct[ip];
+                const int offset = off_ptr[pp.idata(IIx::sid)];
+                if (offset < 0) {
+                    return;
+                }
+
+                const int idx = (offset + pp.idata(IIx::nid)) * AMREX_SPACEDIM;
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    pp.pos(n) = pos_ptr[idx + n];
+                }
+            });
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
 void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
 {
     BL_PROFILE("amr-wind::SamplingContainer::interpolate");
@@ -254,5 +315,61 @@ void SamplingContainer::populate_buffer(std::vector<double>& buf)
         buf.data(), buf.size(), amrex::ParallelDescriptor::IOProcessorNumber());
 }
 
+void SamplingContainer::populate_local_buffer(
+    std::vector<int>& sid, std::vector<int>& nid, std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_local_buffer");
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    int num_local = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            num_local += pti.numParticles();
+        }
+    }
+
+    const int ncomp = NumRuntimeRealComps();
+    amrex::Gpu::DeviceVector<int> dsid(num_local);
+    amrex::Gpu::DeviceVector<int> dnid(num_local);
+    amrex::Gpu::DeviceVector<double> dbuf(num_local * ncomp);
+    auto* dsid_ptr = dsid.data();
+    auto* dnid_ptr = dnid.data();
+    auto* dbuf_ptr = dbuf.data();
+
+    int poffset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                auto& pp = pstruct[ip];
+                dsid_ptr[poffset + ip] = pp.idata(IIx::sid);
+                dnid_ptr[poffset + ip] = pp.idata(IIx::nid);
+            });
+
+            for (int fid = 0; fid < ncomp; ++fid) {
+                const int offset = fid * num_local + poffset;
+                auto* parr = &pti.GetStructOfArrays().GetRealData(fid)[0];
+                amrex::ParallelFor(
+                    np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        dbuf_ptr[offset + ip] = parr[ip];
+                    });
+            }
+            poffset += np;
+        }
+    }
+
+    sid.resize(num_local);
+    nid.resize(num_local);
+    buf.resize(static_cast<size_t>(num_local) * ncomp);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, dsid.begin(), dsid.end(), sid.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, dnid.begin(), dnid.end(), nid.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), buf.begin());
+}
+
 } // namespace sampling
 } // namespace amr_wind
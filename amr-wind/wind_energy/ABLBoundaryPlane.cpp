@@ -94,53 +94,40 @@ void InletData::define_level_data(
 
 #ifdef AMR_WIND_USE_NETCDF
 void InletData::read_data(
-    ncutils::NCGroup& grp,
     const amrex::Orientation ori,
     const int lev,
     const Field* fld,
-    const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const amrex::Vector<amrex::Real>& buffer_n,
+    const amrex::Vector<amrex::Real>& buffer_np1)
 {
     const size_t nc = fld->num_comp();
     const int nstart = m_components[fld->id()];
 
-    const int idx = closest_index(times, time);
-    const int idxp1 = idx + 1;
-    m_tn = times[idx];
-    m_tnp1 = times[idxp1];
-    AMREX_ALWAYS_ASSERT(((m_tn <= time) && (time <= m_tnp1)));
-
     const int normal = ori.coordDir();
     const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
 
     const auto& bx = (*m_data_n[ori])[lev].box();
     const auto& lo = bx.loVect();
-    const size_t n0 = bx.length(perp[0]);
     const size_t n1 = bx.length(perp[1]);
-
-    amrex::Vector<size_t> start{
-        static_cast<size_t>(idx), static_cast<size_t>(lo[perp[0]]),
-        static_cast<size_t>(lo[perp[1]]), 0};
-    amrex::Vector<size_t> count{1, n0, n1, nc};
-    amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
-    grp.var(fld->name()).get(buffer.data(), start, count);
+    AMREX_ALWAYS_ASSERT(
+        buffer_n.size() == static_cast<size_t>(bx.numPts()) * nc);
+    AMREX_ALWAYS_ASSERT(
+        buffer_np1.size() == static_cast<size_t>(bx.numPts()) * nc);
 
     const auto& datn = ((*m_data_n[ori])[lev]).array();
-    auto d_buffer = buffer.dataPtr();
+    const auto* d_buffer_n = buffer_n.data();
     amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
         const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
         const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datn(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
+        datn(i, j, k, n + nstart) = d_buffer_n[((i0 * n1) + i1) * nc + n];
     });
 
-    start[0] = static_cast<size_t>(idxp1);
-    grp.var(fld->name()).get(buffer.data(), start, count);
-
     const auto& datnp1 = ((*m_data_np1[ori])[lev]).array();
+    const auto* d_buffer_np1 = buffer_np1.data();
     amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
         const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
         const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datnp1(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
+        datnp1(i, j, k, n + nstart) = d_buffer_np1[((i0 * n1) + i1) * nc + n];
     });
 
     ((*m_data_n[ori])[lev]).prefetchToDevice();
@@ -281,6 +268,7 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
+    pp.query("bndry_prefetch", m_prefetch_enabled);
 
 #ifndef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
@@ -299,6 +287,30 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
         m_out_fmt = "native";
     }
 
+    // The background reads access the file from a helper thread with
+    // independent MPI-IO operations
+    if (m_prefetch_enabled && (m_io_mode == io_mode::input) &&
+        (m_out_fmt == "netcdf")) {
+        std::string reason;
+#ifndef AMR_WIND_USE_HDF5_THREADSAFE
+        reason = "the HDF5 library is not thread-safe";
+#endif
+#ifdef AMREX_USE_MPI
+        int provided = MPI_THREAD_SINGLE;
+        MPI_Query_thread(&provided);
+        if (provided < MPI_THREAD_MULTIPLE) {
+            reason = "MPI does not provide MPI_THREAD_MULTIPLE";
+        }
+#endif
+        if (!reason.empty()) {
+            amrex::Print() << "Warning: ABL.bndry_prefetch requested but "
+                           << reason
+                           << ", boundary planes are read synchronously"
+                           << std::endl;
+            m_prefetch_enabled = false;
+        }
+    }
+
     // only used for native format
     m_time_file = m_filename + "/time.dat";
 }
@@ -780,20 +792,54 @@ void ABLBoundaryPlane::read_file()
 #ifdef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
 
-        auto ncf = ncutils::NCFile::open_par(
-            m_filename, NC_NOWRITE | NC_NETCDF4 | NC_MPIIO,
-            amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+        if (!m_in_file) {
+            m_in_file = std::make_unique<ncutils::NCFile>(
+                ncutils::NCFile::open_par(
+                    m_filename, NC_NOWRITE | NC_NETCDF4 | NC_MPIIO,
+                    amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL));
+        }
+
+        const int idx = closest_index(m_in_times, time);
+        const int idxp1 = idx + 1;
+        m_in_data.set_times(m_in_times[idx], m_in_times[idxp1]);
+        AMREX_ALWAYS_ASSERT(
+            (m_in_data.tn() <= time) && (time <= m_in_data.tnp1()));
 
+        // The plane at n + 1 becomes the plane at n when advancing by one
+        // interval, so only the new plane at n + 1 has to be read
+        if (m_buf_np1.index == idx) {
+            std::swap(m_buf_n, m_buf_np1);
+        }
+        load_buffers(m_buf_n, idx);
+        load_buffers(m_buf_np1, idxp1);
+
+        // Read the plane for the next interval while this one is used
+        const int idxp2 = idxp1 + 1;
+        if (m_prefetch_enabled && (idxp2 < m_in_times.size()) &&
+            (m_prefetch_idx != idxp2)) {
+            if (m_prefetch.valid()) {
+                m_prefetch.wait();
+            }
+            m_prefetch_idx = idxp2;
+            m_prefetch = std::async(std::launch::async, [this, idxp2]() {
+                return read_buffers(idxp2);
+            });
+        }
+
+        int ibuf = 0;
         for (amrex::OrientationIter oit; oit; ++oit) {
             auto ori = oit();
             if (!m_in_data.is_populated(ori)) continue;
 
-            const std::string plane = m_plane_names[ori];
-            const int nlevels = ncf.group(plane).num_groups();
+            // The file is not queried here since the prefetch may be reading
+            // it, the levels match those of the buffers
+            const int nlevels = m_in_data.nlevels(ori);
             for (auto* fld : m_fields) {
                 for (int lev = 0; lev < nlevels; ++lev) {
-                    auto grp = ncf.group(plane).group(level_name(lev));
-                    m_in_data.read_data(grp, ori, lev, fld, time, m_in_times);
+                    m_in_data.read_data(
+                        ori, lev, fld, m_buf_n.data[ibuf],
+                        m_buf_np1.data[ibuf]);
+                    ++ibuf;
                 }
             }
         }
@@ -865,6 +911,65 @@ void ABLBoundaryPlane::read_file()
     m_in_data.interpolate(time);
 }
 
+#ifdef AMR_WIND_USE_NETCDF
+ABLBoundaryPlane::PlaneBuffers
+ABLBoundaryPlane::read_buffers(const int idx) const
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_buffers");
+    PlaneBuffers buf;
+    buf.index = idx;
+    for (amrex::OrientationIter oit; oit; ++oit) {
+        auto ori = oit();
+        if (!m_in_data.is_populated(ori)) continue;
+
+        const int normal = ori.coordDir();
+        const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
+        const auto plane_grp = m_in_file->group(m_plane_names[ori]);
+        const int nlevels = m_in_data.nlevels(ori);
+        for (auto* fld : m_fields) {
+            for (int lev = 0; lev < nlevels; ++lev) {
+                const auto& bx = m_in_data.plane_box(ori, lev);
+                const auto& lo = bx.loVect();
+                const size_t nc = fld->num_comp();
+                const size_t n0 = bx.length(perp[0]);
+                const size_t n1 = bx.length(perp[1]);
+
+                const std::vector<size_t> start{
+                    static_cast<size_t>(idx), static_cast<size_t>(lo[perp[0]]),
+                    static_cast<size_t>(lo[perp[1]]), 0};
+                const std::vector<size_t> count{1, n0, n1, nc};
+                amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
+                plane_grp.group(level_name(lev))
+                    .var(fld->name())
+                    .get(buffer.data(), start, count);
+                buf.data.push_back(std::move(buffer));
+            }
+        }
+    }
+    return buf;
+}
+
+void ABLBoundaryPlane::load_buffers(PlaneBuffers& buf, const int idx)
+{
+    if (buf.index == idx) {
+        return;
+    }
+
+    // Wait for the pending background read, which may already hold the
+    // requested plane, before reading on this thread
+    if (m_prefetch.valid()) {
+        BL_PROFILE("amr-wind::ABLBoundaryPlane::wait_prefetch");
+        auto prefetched = m_prefetch.get();
+        m_prefetch_idx = -1;
+        if (prefetched.index == idx) {
+            buf = std::move(prefetched);
+            return;
+        }
+    }
+    buf = read_buffers(idx);
+}
+#endif
+
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 void ABLBoundaryPlane::populate_data(
     const int lev,
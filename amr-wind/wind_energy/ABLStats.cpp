@@ -1,5 +1,4 @@
 #include "amr-wind/wind_energy/ABLStats.H"
-#include "amr-wind/fvm/gradient.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/DirectionSelector.H"
@@ -9,17 +8,112 @@
 
 #include "AMReX_ParmParse.H"
 #include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParallelReduce.H"
+#include "AMReX_OpenMP.H"
+
+#include <cstring>
 
 namespace amr_wind {
 
 namespace {
-struct TemperatureGradient
+
+//! Number of low bits of the argmax key that hold the cell index
+constexpr int zi_index_bits = 20;
+
+/** Pack a gradient and its cell index into a key ordered by the gradient
+ *
+ *  The gradient is mapped to an unsigned integer preserving its ordering and
+ *  its lowest bits are replaced by the cell index, such that an atomic max of
+ *  the keys returns the location of the maximum. Ties are resolved in favor
+ *  of the lower cell index.
+ */
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE unsigned long long
+zi_key(const amrex::Real grad, const int idx)
 {
-    double grad_z;
-    double max_grad_loc;
-};
+    const double dgrad = grad;
+    unsigned long long bits = 0;
+    std::memcpy(&bits, &dgrad, sizeof(bits));
+    constexpr unsigned long long sign_bit = 1ULL << 63;
+    bits = ((bits & sign_bit) != 0ULL) ? ~bits : (bits | sign_bit);
+
+    constexpr unsigned long long idx_mask = (1ULL << zi_index_bits) - 1;
+    return (bits & ~idx_mask) |
+           (idx_mask - static_cast<unsigned long long>(idx));
+}
+
 } // namespace
 
+amrex::Real
+compute_inversion_height(const Field& temperature, const int normal_dir)
+{
+    BL_PROFILE("amr-wind::compute_inversion_height");
+
+    const auto& grad_temp = temperature.repo().cached_gradient(temperature);
+
+    // Only compute zi using coarsest level
+    const auto& geom = temperature.repo().mesh().Geom(0);
+    const amrex::Box& domain = geom.Domain();
+    const int h1 = (normal_dir == 0) ? 1 : 0;
+    const int h2 = (normal_dir == 2) ? 1 : 2;
+    const int nh1 = domain.length(h1);
+    const int ncols = nh1 * domain.length(h2);
+    const amrex::IntVect dlo = domain.smallEnd();
+    AMREX_ALWAYS_ASSERT(domain.length(normal_dir) < (1 << zi_index_bits));
+
+    // Packed (gradient, cell index) argmax key for each column. The atomic
+    // max is not atomic on the host, so each OpenMP thread updates its own
+    // copy of the keys, merged after the loop.
+    const int nthreads = amrex::OpenMP::get_max_threads();
+    amrex::Gpu::DeviceVector<unsigned long long> keys(
+        static_cast<size_t>(nthreads) * ncols, 0ULL);
+    auto* keys_ptr = keys.data();
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(grad_temp(0), amrex::TilingIfNotGPU());
+         mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& gradT_arr = grad_temp(0).const_array(mfi);
+        auto* tkeys =
+            keys_ptr + static_cast<size_t>(amrex::OpenMP::get_thread_num()) *
+                           ncols;
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const amrex::IntVect iv(i, j, k);
+                const int col = (iv[h2] - dlo[h2]) * nh1 + (iv[h1] - dlo[h1]);
+                amrex::Gpu::Atomic::Max(
+                    &tkeys[col],
+                    zi_key(
+                        gradT_arr(i, j, k, normal_dir),
+                        iv[normal_dir] - dlo[normal_dir]));
+            });
+    }
+
+    amrex::Vector<unsigned long long> tkeys_h(keys.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, keys.begin(), keys.end(), tkeys_h.begin());
+    amrex::Vector<unsigned long long> hkeys(
+        tkeys_h.begin(), tkeys_h.begin() + ncols);
+    for (int it = 1; it < nthreads; ++it) {
+        const auto* tk = &tkeys_h[static_cast<size_t>(it) * ncols];
+        for (int ic = 0; ic < ncols; ++ic) {
+            hkeys[ic] = amrex::max(hkeys[ic], tk[ic]);
+        }
+    }
+    amrex::ParallelAllReduce::Max(
+        hkeys.data(), ncols, amrex::ParallelContext::CommunicatorSub());
+
+    constexpr unsigned long long idx_mask = (1ULL << zi_index_bits) - 1;
+    const amrex::Real dn = geom.CellSize(normal_dir);
+    amrex::Real zi = 0.0;
+    for (const auto key : hkeys) {
+        const auto idx = static_cast<int>(idx_mask - (key & idx_mask));
+        zi += (idx + 0.5) * dn;
+    }
+    return zi / static_cast<amrex::Real>(ncols);
+}
+
 ABLStats::ABLStats(
     CFDSim& sim, const ABLWallFunction& abl_wall_func, const int dir)
     : m_sim(sim)
@@ -29,10 +123,14 @@ ABLStats::ABLStats(
     , m_pa_vel(sim, dir)
     , m_pa_temp(m_temperature, sim.time(), dir)
     , m_pa_mueff(m_mueff, sim.time(), dir)
-    , m_pa_tu(m_pa_vel, m_pa_temp)
-    , m_pa_uu(m_pa_vel, m_pa_vel)
-    , m_pa_uuu(m_pa_vel, m_pa_vel, m_pa_vel)
-{}
+    , m_pa_tu(m_pa_stats, m_pa_vel, m_pa_temp)
+    , m_pa_uu(m_pa_stats, m_pa_vel, m_pa_vel)
+    , m_pa_uuu(m_pa_stats, m_pa_vel, m_pa_vel, m_pa_vel)
+{
+    m_pa_mean.add_average(m_pa_vel);
+    m_pa_mean.add_average(m_pa_temp);
+    m_pa_stats.add_average(m_pa_mueff);
+}
 
 ABLStats::~ABLStats() = default;
 
@@ -59,27 +157,6 @@ void ABLStats::initialize()
         pp.get("reference_temperature", m_ref_theta);
     }
 
-    // Get normal direction and associated stuff
-    const auto& geom = (this->m_sim.repo()).mesh().Geom()[0];
-    amrex::Box const& domain = geom.Domain();
-    const auto dlo = amrex::lbound(domain);
-    const auto dhi = amrex::ubound(domain);
-    switch (m_normal_dir) {
-    case 0:
-        m_ncells_h1 = dhi.y - dlo.y + 1;
-        m_ncells_h2 = dhi.z - dlo.z + 1;
-        break;
-    case 1:
-        m_ncells_h1 = dhi.x - dlo.x + 1;
-        m_ncells_h2 = dhi.z - dlo.z + 1;
-        break;
-    case 2:
-        m_ncells_h1 = dhi.x - dlo.x + 1;
-        m_ncells_h2 = dhi.y - dlo.y + 1;
-        break;
-    }
-    m_dn = geom.CellSize()[m_normal_dir];
-
     if (m_out_fmt == "netcdf") {
         prepare_netcdf_file();
     } else {
@@ -87,11 +164,7 @@ void ABLStats::initialize()
     }
 }
 
-void ABLStats::calc_averages()
-{
-    m_pa_vel();
-    m_pa_temp();
-}
+void ABLStats::calc_averages() { m_pa_mean(); }
 
 //! Calculate sfs stress averages
 void ABLStats::calc_sfs_stress_avgs(
@@ -103,12 +176,10 @@ void ABLStats::calc_sfs_stress_avgs(
     auto& repo = m_sim.repo();
 
     const auto& m_vel = repo.get_field("velocity");
-    auto gradVel = repo.create_scratch_field(9);
-    fvm::gradient(*gradVel, m_vel);
+    const auto& gradVel = repo.cached_gradient(m_vel);
 
     const auto& alphaeff = repo.get_field(pde_impl::mueff_name("temperature"));
-    auto gradT = repo.create_scratch_field(3);
-    fvm::gradient(*gradT, m_temperature);
+    const auto& gradT = repo.cached_gradient(m_temperature);
 
     const int nlevels = repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
@@ -116,8 +187,8 @@ void ABLStats::calc_sfs_stress_avgs(
             const auto& bx = mfi.tilebox();
             const auto& mueff_arr = m_mueff(lev).array(mfi);
             const auto& alphaeff_arr = alphaeff(lev).array(mfi);
-            const auto& gradVel_arr = (*gradVel)(lev).array(mfi);
-            const auto& gradT_arr = (*gradT)(lev).array(mfi);
+            const auto& gradVel_arr = gradVel(lev).const_array(mfi);
+            const auto& gradT_arr = gradT(lev).const_array(mfi);
             const auto& sfs_arr = sfs_stress(lev).array(mfi);
             const auto& t_sfs_arr = t_sfs_stress(lev).array(mfi);
 
@@ -156,84 +227,14 @@ void ABLStats::post_advance_work()
         return;
     }
 
-    switch (m_normal_dir) {
-    case 0:
-        compute_zi(YDir(), ZDir());
-        break;
-    case 1:
-        compute_zi(XDir(), ZDir());
-        break;
-    case 2:
-        compute_zi(XDir(), YDir());
-        break;
-    }
+    m_zi = compute_inversion_height(m_temperature, m_normal_dir);
 
-    m_pa_tu();
-    m_pa_uu();
-    m_pa_uuu();
+    // Moments about the mean profiles and mueff average in a single pass
+    m_pa_stats();
 
     process_output();
 }
 
-template <typename h1_dir, typename h2_dir>
-void ABLStats::compute_zi(const h1_dir& h1Sel, const h2_dir& h2Sel)
-{
-
-    auto gradT = (this->m_sim.repo())
-                     .create_scratch_field(3, m_temperature.num_grow()[0]);
-    fvm::gradient(*gradT, m_temperature);
-
-    // Only compute zi using coarsest level
-
-    amrex::Gpu::DeviceVector<TemperatureGradient> tgrad(
-        m_ncells_h1 * m_ncells_h2);
-    auto* tgrad_ptr = tgrad.data();
-    {
-        const int normal_dir = m_normal_dir;
-        const size_t ncells_h1 = m_ncells_h1;
-        amrex::Real dnval = m_dn;
-        for (amrex::MFIter mfi(m_temperature(0)); mfi.isValid(); ++mfi) {
-            const auto& bx = mfi.tilebox();
-            const auto& gradT_arr = (*gradT)(0).array(mfi);
-            amrex::ParallelFor(
-                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                    int h1 = h1Sel(i, j, k);
-                    int h2 = h2Sel(i, j, k);
-                    if (tgrad_ptr[h2 * ncells_h1 + h1].grad_z <
-                        gradT_arr(i, j, k, normal_dir)) {
-                        tgrad_ptr[h2 * ncells_h1 + h1].grad_z =
-                            gradT_arr(i, j, k, normal_dir);
-                        tgrad_ptr[h2 * ncells_h1 + h1].max_grad_loc =
-                            (k + 0.5) * dnval;
-                    }
-                });
-        }
-    }
-
-    amrex::Vector<TemperatureGradient> temp_grad(m_ncells_h1 * m_ncells_h2);
-    amrex::Vector<TemperatureGradient> gtemp_grad(m_ncells_h1 * m_ncells_h2);
-    amrex::Gpu::copy(
-        amrex::Gpu::deviceToHost, tgrad.begin(), tgrad.end(),
-        temp_grad.begin());
-#ifdef AMREX_USE_MPI
-    MPI_Reduce(
-        &temp_grad[0], &gtemp_grad[0], m_ncells_h1 * m_ncells_h2,
-        MPI_2DOUBLE_PRECISION, MPI_MAXLOC,
-        amrex::ParallelDescriptor::IOProcessorNumber(),
-        amrex::ParallelDescriptor::Communicator());
-#endif
-
-    m_zi = 0.0;
-    if (amrex::ParallelDescriptor::IOProcessor()) {
-        for (size_t i = 0; i < m_ncells_h1 * m_ncells_h2; i++) {
-            m_zi += gtemp_grad[i].max_grad_loc;
-        }
-        m_zi /=
-            (static_cast<double>(m_ncells_h1) *
-             static_cast<double>(m_ncells_h2));
-    }
-}
-
 void ABLStats::process_output()
 {
 
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <set>
 
 namespace amr_wind {
 namespace actuator {
@@ -25,6 +26,16 @@ void Actuator::pre_init_actions()
     amrex::Vector<std::string> labels;
     pp.getarr("labels", labels);
 
+    std::string exchange{"global"};
+    pp.query("velocity_exchange", exchange);
+    if (exchange == "neighborhood") {
+        m_neighborhood_exchange = true;
+    } else if (exchange != "global") {
+        amrex::Abort(
+            "Actuator: invalid velocity_exchange = " + exchange +
+            ", must be global or neighborhood");
+    }
+
     const int nturbines = labels.size();
 
     for (int i = 0; i < nturbines; ++i) {
@@ -121,6 +132,17 @@ void Actuator::setup_container()
         }
     }
 
+    if (m_neighborhood_exchange) {
+        std::set<int> procs;
+        for (const auto& act : m_actuators) {
+            const auto& info = act->info();
+            if (info.sample_vel_in_proc) {
+                procs.insert(info.procs.begin(), info.procs.end());
+            }
+        }
+        m_container->use_neighborhood_exchange(procs);
+    }
+
     m_container->initialize_container();
 }
 
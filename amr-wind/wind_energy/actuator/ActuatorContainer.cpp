@@ -6,10 +6,47 @@
 #include "AMReX_Scan.H"
 
 #include <algorithm>
+#include <map>
 
 namespace amr_wind {
 namespace actuator {
 
+namespace {
+
+//! Trilinear interpolation of a cell-centered field at a given location
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real interp_trilinear(
+    const amrex::Array4<const amrex::Real>& varr,
+    const amrex::Real x,
+    const amrex::Real y,
+    const amrex::Real z,
+    const int ic)
+{
+    // Index of the low corner
+    const int i = static_cast<int>(amrex::Math::floor(x));
+    const int j = static_cast<int>(amrex::Math::floor(y));
+    const int k = static_cast<int>(amrex::Math::floor(z));
+
+    // Interpolation weights in each direction (linear basis)
+    const amrex::Real wx_hi = (x - i);
+    const amrex::Real wy_hi = (y - j);
+    const amrex::Real wz_hi = (z - k);
+
+    const amrex::Real wx_lo = 1.0 - wx_hi;
+    const amrex::Real wy_lo = 1.0 - wy_hi;
+    const amrex::Real wz_lo = 1.0 - wz_hi;
+
+    return wx_lo * wy_lo * wz_lo * varr(i, j, k, ic) +
+           wx_lo * wy_lo * wz_hi * varr(i, j, k + 1, ic) +
+           wx_lo * wy_hi * wz_lo * varr(i, j + 1, k, ic) +
+           wx_lo * wy_hi * wz_hi * varr(i, j + 1, k + 1, ic) +
+           wx_hi * wy_lo * wz_lo * varr(i + 1, j, k, ic) +
+           wx_hi * wy_lo * wz_hi * varr(i + 1, j, k + 1, ic) +
+           wx_hi * wy_hi * wz_lo * varr(i + 1, j + 1, k, ic) +
+           wx_hi * wy_hi * wz_hi * varr(i + 1, j + 1, k + 1, ic);
+}
+
+} // namespace
+
 ActuatorCloud::ActuatorCloud(const int nobjects)
     : num_pts(nobjects, 0), global_id(nobjects, -1), num_objects(nobjects)
 {}
@@ -29,6 +66,19 @@ ActuatorContainer::ActuatorContainer(
     , m_proc_offsets_device(amrex::ParallelDescriptor::NProcs() + 1)
 {}
 
+void ActuatorContainer::use_neighborhood_exchange(const std::set<int>& procs)
+{
+    AMREX_ALWAYS_ASSERT(!m_container_initialized);
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    m_neighborhood = true;
+    m_sampling_procs.clear();
+    for (const int ip : procs) {
+        if (ip != iproc) {
+            m_sampling_procs.push_back(ip);
+        }
+    }
+}
+
 /** Allocate memory and initialize the particles within the container
  *
  *  This method is only called once during the simulation. It allocates the
@@ -42,14 +92,22 @@ void ActuatorContainer::initialize_container()
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::initialize_container");
 
-    compute_local_coordinates();
-
     // Initialize global data arrays
     const int total_pts =
         std::accumulate(m_data.num_pts.begin(), m_data.num_pts.end(), 0);
     m_data.position.resize(total_pts);
     m_data.velocity.resize(total_pts);
 
+    // No particles are used with the neighborhood exchange
+    if (m_neighborhood) {
+        m_neighborhood_ready = false;
+        m_container_initialized = true;
+        m_is_scattered = false;
+        return;
+    }
+
+    compute_local_coordinates();
+
     {
         const int nproc = amrex::ParallelDescriptor::NProcs();
         amrex::Vector<int> pts_per_proc(nproc, 0);
@@ -120,6 +178,10 @@ void ActuatorContainer::initialize_particles(const int total_pts)
 
 void ActuatorContainer::reset_container()
 {
+    if (m_neighborhood) {
+        return;
+    }
+
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
@@ -156,6 +218,12 @@ void ActuatorContainer::update_positions()
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::update_positions");
     AMREX_ALWAYS_ASSERT(m_container_initialized && !m_is_scattered);
 
+    // Positions are sent along with the velocity requests
+    if (m_neighborhood) {
+        m_is_scattered = true;
+        return;
+    }
+
     const auto dpos = gpu::device_view(m_data.position);
     const auto* const dptr = dpos.data();
     const int nlevels = m_mesh.finestLevel() + 1;
@@ -198,15 +266,19 @@ void ActuatorContainer::sample_velocities(const Field& vel)
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::sample_velocities");
     AMREX_ALWAYS_ASSERT(m_container_initialized && m_is_scattered);
 
-    // Sample velocity field
-    interpolate_velocities(vel);
+    if (m_neighborhood) {
+        exchange_velocities(vel);
+    } else {
+        // Sample velocity field
+        interpolate_velocities(vel);
 
-    // Recall particles to the MPI ranks that contains their corresponding
-    // turbines
-    // Redistribute();
+        // Recall particles to the MPI ranks that contains their corresponding
+        // turbines
+        // Redistribute();
 
-    // Populate the velocity buffer that all actuator instances can access
-    populate_vel_buffer();
+        // Populate the velocity buffer that all actuator instances can access
+        populate_vel_buffer();
+    }
 
     // Indicate that the particles have been restored to their original MPI rank
     m_is_scattered = false;
@@ -294,32 +366,10 @@ void ActuatorContainer::interpolate_velocities(const Field& vel)
                 const amrex::Real z =
                     (pp.pos(2) - plo[2] - 0.5 * dx[2]) * dxi[2];
 
-                // Index of the low corner
-                const int i = static_cast<int>(amrex::Math::floor(x));
-                const int j = static_cast<int>(amrex::Math::floor(y));
-                const int k = static_cast<int>(amrex::Math::floor(z));
-
-                // Interpolation weights in each direction (linear basis)
-                const amrex::Real wx_hi = (x - i);
-                const amrex::Real wy_hi = (y - j);
-                const amrex::Real wz_hi = (z - k);
-
-                const amrex::Real wx_lo = 1.0 - wx_hi;
-                const amrex::Real wy_lo = 1.0 - wy_hi;
-                const amrex::Real wz_lo = 1.0 - wz_hi;
-
                 const int iproc = pp.cpu();
 
                 for (int ic = 0; ic < AMREX_SPACEDIM; ++ic) {
-                    pp.rdata(ic) =
-                        wx_lo * wy_lo * wz_lo * varr(i, j, k, ic) +
-                        wx_lo * wy_lo * wz_hi * varr(i, j, k + 1, ic) +
-                        wx_lo * wy_hi * wz_lo * varr(i, j + 1, k, ic) +
-                        wx_lo * wy_hi * wz_hi * varr(i, j + 1, k + 1, ic) +
-                        wx_hi * wy_lo * wz_lo * varr(i + 1, j, k, ic) +
-                        wx_hi * wy_lo * wz_hi * varr(i + 1, j, k + 1, ic) +
-                        wx_hi * wy_hi * wz_lo * varr(i + 1, j + 1, k, ic) +
-                        wx_hi * wy_hi * wz_hi * varr(i + 1, j + 1, k + 1, ic);
+                    pp.rdata(ic) = interp_trilinear(varr, x, y, z, ic);
 
                     // Reset position vectors so that the particles return back
                     // to the MPI ranks with the turbines upon redistribution
@@ -386,6 +436,272 @@ void ActuatorContainer::compute_local_coordinates()
         m_pos_device.begin());
 }
 
+std::pair<int, int>
+ActuatorContainer::locate_point(const vs::Vector& pos) const
+{
+    for (int lev = m_mesh.finestLevel(); lev >= 0; --lev) {
+        const auto& geom = m_mesh.Geom(lev);
+        const auto* problo = geom.ProbLo();
+        const auto* dxi = geom.InvCellSize();
+        amrex::IntVect iv;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            iv[d] = static_cast<int>(
+                amrex::Math::floor((pos[d] - problo[d]) * dxi[d]));
+        }
+        if (!geom.Domain().contains(iv)) {
+            continue;
+        }
+
+        const auto isects =
+            m_mesh.boxArray(lev).intersections(amrex::Box(iv, iv), true, 0);
+        if (!isects.empty()) {
+            return std::make_pair(lev, isects[0].first);
+        }
+    }
+    return std::make_pair(-1, -1);
+}
+
+/** Determine the ranks exchanging velocities with this rank
+ *
+ *  The ranks owning the current actuator points are added to the ranks
+ *  provided by the actuator instances, and the requesting ranks are determined
+ *  with a single all-to-all exchange of flags. This is done once after the
+ *  container is initialized, i.e., once per regrid.
+ */
+void ActuatorContainer::setup_neighborhood()
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorContainer::setup_neighborhood");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+
+    amrex::Vector<int> send_flags(nprocs, 0);
+    for (const int ip : m_sampling_procs) {
+        send_flags[ip] = 1;
+    }
+    for (const auto& pos : m_data.position) {
+        const auto loc = locate_point(pos);
+        if (loc.first > -1) {
+            send_flags[m_mesh.DistributionMap(loc.first)[loc.second]] = 1;
+        }
+    }
+    send_flags[iproc] = 0;
+
+    amrex::Vector<int> recv_flags(nprocs, 0);
+#ifdef AMREX_USE_MPI
+    MPI_Alltoall(
+        send_flags.data(), 1, MPI_INT, recv_flags.data(), 1, MPI_INT,
+        amrex::ParallelDescriptor::Communicator());
+#endif
+
+    m_sampling_procs.clear();
+    m_requesting_procs.clear();
+    for (int ip = 0; ip < nprocs; ++ip) {
+        if (send_flags[ip] > 0) {
+            m_sampling_procs.push_back(ip);
+        }
+        if (recv_flags[ip] > 0) {
+            m_requesting_procs.push_back(ip);
+        }
+    }
+    m_neighborhood_ready = true;
+}
+
+/** Sample velocities at the actuator points with point-to-point messages
+ *
+ *  The positions of the points are sent to the ranks owning the grids that
+ *  contain them, which interpolate the velocity field and send the velocities
+ *  back. Every rank sends one (possibly empty) message to each of its sampling
+ *  ranks, so no global communication is required. Points outside the domain
+ *  get a zero velocity.
+ */
+void ActuatorContainer::exchange_velocities(const Field& vel)
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorContainer::exchange_velocities");
+    if (!m_neighborhood_ready) {
+        setup_neighborhood();
+    }
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const auto& pos = m_data.position;
+    auto& pvel = m_data.velocity;
+    const int npts = pos.size();
+    const int nsend = m_sampling_procs.size();
+
+    // Sort the points by the rank owning them
+    amrex::Vector<amrex::Vector<int>> send_idx(nsend);
+    amrex::Vector<int> local_idx;
+    for (int i = 0; i < npts; ++i) {
+        pvel[i] = vs::Vector::zero();
+        const auto loc = locate_point(pos[i]);
+        if (loc.first < 0) {
+            continue;
+        }
+
+        const int owner = m_mesh.DistributionMap(loc.first)[loc.second];
+        if (owner == iproc) {
+            local_idx.push_back(i);
+            continue;
+        }
+        const auto it =
+            std::find(m_sampling_procs.begin(), m_sampling_procs.end(), owner);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+            it != m_sampling_procs.end(),
+            "Actuator point moved outside the neighborhood of its actuator, "
+            "use Actuator.velocity_exchange = global");
+        send_idx[std::distance(m_sampling_procs.begin(), it)].push_back(i);
+    }
+
+#ifdef AMREX_USE_MPI
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    const auto mpi_real =
+        amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+    const int pos_tag = amrex::ParallelDescriptor::SeqNum();
+    const int vel_tag = amrex::ParallelDescriptor::SeqNum();
+
+    // Send the positions to the owning ranks and post the receives for the
+    // sampled velocities
+    amrex::Vector<amrex::Vector<vs::Vector>> send_pos(nsend);
+    amrex::Vector<amrex::Vector<vs::Vector>> recv_vel(nsend);
+    amrex::Vector<MPI_Request> pos_reqs(nsend, MPI_REQUEST_NULL);
+    amrex::Vector<MPI_Request> vel_reqs(nsend, MPI_REQUEST_NULL);
+    for (int n = 0; n < nsend; ++n) {
+        const int np = send_idx[n].size();
+        send_pos[n].resize(np);
+        for (int i = 0; i < np; ++i) {
+            send_pos[n][i] = pos[send_idx[n][i]];
+        }
+        MPI_Isend(
+            send_pos[n].data(), np * vs::Vector::ncomp, mpi_real,
+            m_sampling_procs[n], pos_tag, comm, &pos_reqs[n]);
+
+        if (np > 0) {
+            recv_vel[n].resize(np);
+            MPI_Irecv(
+                recv_vel[n].data(), np * vs::Vector::ncomp, mpi_real,
+                m_sampling_procs[n], vel_tag, comm, &vel_reqs[n]);
+        }
+    }
+#endif
+
+    // Sample the points owned by this rank while the messages are in flight
+    {
+        const int np = local_idx.size();
+        amrex::Vector<vs::Vector> lpos(np);
+        amrex::Vector<vs::Vector> lvel;
+        for (int i = 0; i < np; ++i) {
+            lpos[i] = pos[local_idx[i]];
+        }
+        interpolate_points(vel, lpos, lvel);
+        for (int i = 0; i < np; ++i) {
+            pvel[local_idx[i]] = lvel[i];
+        }
+    }
+
+#ifdef AMREX_USE_MPI
+    // Sample the points requested by the neighboring ranks
+    const int nreq = m_requesting_procs.size();
+    amrex::Vector<amrex::Vector<vs::Vector>> req_pos(nreq);
+    amrex::Vector<amrex::Vector<vs::Vector>> req_vel(nreq);
+    amrex::Vector<MPI_Request> reply_reqs(nreq, MPI_REQUEST_NULL);
+    for (int n = 0; n < nreq; ++n) {
+        MPI_Status status;
+        MPI_Probe(m_requesting_procs[n], pos_tag, comm, &status);
+        int count = 0;
+        MPI_Get_count(&status, mpi_real, &count);
+        req_pos[n].resize(count / vs::Vector::ncomp);
+        MPI_Recv(
+            req_pos[n].data(), count, mpi_real, m_requesting_procs[n],
+            pos_tag, comm, MPI_STATUS_IGNORE);
+        if (count < 1) {
+            continue;
+        }
+
+        interpolate_points(vel, req_pos[n], req_vel[n]);
+        MPI_Isend(
+            req_vel[n].data(), count, mpi_real, m_requesting_procs[n],
+            vel_tag, comm, &reply_reqs[n]);
+    }
+
+    MPI_Waitall(nsend, vel_reqs.data(), MPI_STATUSES_IGNORE);
+    for (int n = 0; n < nsend; ++n) {
+        const int np = send_idx[n].size();
+        for (int i = 0; i < np; ++i) {
+            pvel[send_idx[n][i]] = recv_vel[n][i];
+        }
+    }
+    MPI_Waitall(nsend, pos_reqs.data(), MPI_STATUSES_IGNORE);
+    MPI_Waitall(nreq, reply_reqs.data(), MPI_STATUSES_IGNORE);
+#endif
+}
+
+/** Interpolate the velocity field at points contained in grids owned by this
+ *  rank
+ *
+ *  The points are grouped by the grid containing them on the finest level,
+ *  and a trilinear interpolation is performed for each group.
+ */
+void ActuatorContainer::interpolate_points(
+    const Field& vel,
+    const amrex::Vector<vs::Vector>& pos,
+    amrex::Vector<vs::Vector>& pvel) const
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorContainer::interpolate_points");
+    const int npts = pos.size();
+    pvel.assign(npts, vs::Vector::zero());
+
+    std::map<std::pair<int, int>, amrex::Vector<int>> groups;
+    for (int i = 0; i < npts; ++i) {
+        const auto loc = locate_point(pos[i]);
+        if (loc.first > -1) {
+            AMREX_ASSERT(
+                m_mesh.DistributionMap(loc.first)[loc.second] ==
+                amrex::ParallelDescriptor::MyProc());
+            groups[loc].push_back(i);
+        }
+    }
+
+    for (const auto& grp : groups) {
+        const int lev = grp.first.first;
+        const auto& idx = grp.second;
+        const int np = idx.size();
+
+        amrex::Vector<vs::Vector> gpos(np);
+        for (int i = 0; i < np; ++i) {
+            gpos[i] = pos[idx[i]];
+        }
+        amrex::Gpu::DeviceVector<vs::Vector> dpos(np);
+        amrex::Gpu::DeviceVector<vs::Vector> dvel(np);
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, gpos.begin(), gpos.end(), dpos.begin());
+
+        const auto& geom = m_mesh.Geom(lev);
+        const auto dx = geom.CellSizeArray();
+        const auto dxi = geom.InvCellSizeArray();
+        const auto plo = geom.ProbLoArray();
+        const auto varr = vel(lev).const_array(grp.first.second);
+        const auto* pptr = dpos.data();
+        auto* vptr = dvel.data();
+
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+            const auto& pp = pptr[ip];
+            // Determine offsets within the containing cell
+            const amrex::Real x = (pp.x() - plo[0] - 0.5 * dx[0]) * dxi[0];
+            const amrex::Real y = (pp.y() - plo[1] - 0.5 * dx[1]) * dxi[1];
+            const amrex::Real z = (pp.z() - plo[2] - 0.5 * dx[2]) * dxi[2];
+
+            for (int ic = 0; ic < AMREX_SPACEDIM; ++ic) {
+                vptr[ip][ic] = interp_trilinear(varr, x, y, z, ic);
+            }
+        });
+
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, dvel.begin(), dvel.end(), gpos.begin());
+        for (int i = 0; i < np; ++i) {
+            pvel[idx[i]] = gpos[i];
+        }
+    }
+}
+
 void ActuatorContainer::post_regrid_actions() { compute_local_coordinates(); }
 
 } // namespace actuator
@@ -0,0 +1,114 @@
+#include "amr-wind/wind_energy/actuator/SpreadingBins.H"
+
+#include "AMReX_BLProfiler.H"
+
+namespace amr_wind {
+namespace actuator {
+
+void SpreadingBins::update(
+    const VecList& coords,
+    const vs::Vector& lo,
+    const vs::Vector& dx,
+    const amrex::GpuArray<int, AMREX_SPACEDIM>& nbins,
+    const bool periodic)
+{
+    BL_PROFILE("amr-wind::actuator::SpreadingBins::update");
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        AMREX_ALWAYS_ASSERT(nbins[d] > 0);
+        AMREX_ALWAYS_ASSERT(dx[d] > 0.0);
+    }
+    m_lo = lo;
+    m_dx = dx;
+    m_nbins = nbins;
+    m_periodic = periodic;
+
+    const int nsamples = coords.size();
+    const int ntotal = nbins[0] * nbins[1] * nbins[2];
+    m_offsets_h.assign(ntotal + 1, 0);
+    amrex::Vector<int> sample_bin(nsamples);
+    for (int is = 0; is < nsamples; ++is) {
+        int idx[AMREX_SPACEDIM];
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            const int ib = static_cast<int>(
+                amrex::Math::floor((coords[is][d] - lo[d]) / dx[d]));
+            idx[d] = amrex::max(0, amrex::min(nbins[d] - 1, ib));
+        }
+        sample_bin[is] = (idx[2] * nbins[1] + idx[1]) * nbins[0] + idx[0];
+        ++m_offsets_h[sample_bin[is] + 1];
+    }
+    for (int ib = 0; ib < ntotal; ++ib) {
+        m_offsets_h[ib + 1] += m_offsets_h[ib];
+    }
+
+    amrex::Vector<int> sorted(nsamples);
+    {
+        amrex::Vector<int> fill(m_offsets_h.begin(), m_offsets_h.end());
+        for (int is = 0; is < nsamples; ++is) {
+            sorted[fill[sample_bin[is]]++] = is;
+        }
+    }
+
+    m_offsets.resize(ntotal + 1);
+    m_samples.resize(nsamples);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_offsets_h.begin(), m_offsets_h.end(),
+        m_offsets.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, sorted.begin(), sorted.end(),
+        m_samples.begin());
+}
+
+int SpreadingBins::num_samples_near(
+    const amrex::Real* lo, const amrex::Real* hi) const
+{
+    if (num_samples() < 1) {
+        return 0;
+    }
+
+    int blo[AMREX_SPACEDIM];
+    int bhi[AMREX_SPACEDIM];
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        // All bins in the periodic direction are considered
+        if (m_periodic && (d == 1)) {
+            blo[d] = 0;
+            bhi[d] = m_nbins[d] - 1;
+            continue;
+        }
+        const int ilo =
+            static_cast<int>(amrex::Math::floor((lo[d] - m_lo[d]) / m_dx[d]));
+        const int ihi =
+            static_cast<int>(amrex::Math::floor((hi[d] - m_lo[d]) / m_dx[d]));
+        blo[d] = amrex::max(0, ilo - 1);
+        bhi[d] = amrex::min(m_nbins[d] - 1, ihi + 1);
+        if (blo[d] > bhi[d]) {
+            return 0;
+        }
+    }
+
+    int count = 0;
+    for (int bk = blo[2]; bk <= bhi[2]; ++bk) {
+        for (int bj = blo[1]; bj <= bhi[1]; ++bj) {
+            const int ib0 = (bk * m_nbins[1] + bj) * m_nbins[0];
+            count +=
+                m_offsets_h[ib0 + bhi[0] + 1] - m_offsets_h[ib0 + blo[0]];
+        }
+    }
+    return count;
+}
+
+SpreadingBins::View SpreadingBins::view() const
+{
+    View v;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        v.lo[d] = m_lo[d];
+        v.dxinv[d] = 1.0 / m_dx[d];
+        v.nbins[d] = m_nbins[d];
+    }
+    v.periodic = m_periodic;
+    v.offsets = m_offsets.data();
+    v.samples = m_samples.data();
+    return v;
+}
+
+} // namespace actuator
+} // namespace amr_wind
@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <algorithm>
+#include <cmath>
 
 namespace amr_wind {
 namespace actuator {
@@ -13,11 +14,32 @@ AirfoilTable::AirfoilTable(const int num_entries)
 
 AirfoilTable::~AirfoilTable() = default;
 
+vs::Vector AirfoilTable::interpolate(const amrex::Real aoa) const
+{
+    if (!m_uniform) {
+        namespace interp = ::amr_wind::interp;
+        return interp::linear(m_aoa, m_polar, aoa);
+    }
+
+    // Same clipping at the ends of the table as the linear interpolation
+    const int nlast = static_cast<int>(m_uniform_polar.size()) - 1;
+    const amrex::Real xa = (aoa - m_uniform_aoa0) * m_uniform_dinv;
+    if (xa <= 0.0) {
+        return m_uniform_polar[0];
+    }
+    if (xa >= nlast) {
+        return m_uniform_polar[nlast];
+    }
+    const int idx = static_cast<int>(xa);
+    const amrex::Real facR = xa - idx;
+    return (1.0 - facR) * m_uniform_polar[idx] +
+           facR * m_uniform_polar[idx + 1];
+}
+
 void AirfoilTable::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    const vs::Vector polar = interpolate(aoa);
     cl = polar.x();
     cd = polar.y();
 }
@@ -28,13 +50,65 @@ void AirfoilTable::operator()(
     amrex::Real& cd,
     amrex::Real& cm) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    const vs::Vector polar = interpolate(aoa);
     cl = polar.x();
     cd = polar.y();
     cm = polar.z();
 }
 
+void AirfoilTable::lookup(
+    const RealList& aoa, RealList& cl, RealList& cd) const
+{
+    const int npts = aoa.size();
+    cl.resize(npts);
+    cd.resize(npts);
+    if (!m_uniform) {
+        for (int i = 0; i < npts; ++i) {
+            (*this)(aoa[i], cl[i], cd[i]);
+        }
+        return;
+    }
+
+    // Branch-free loop over all sections using the uniform grid
+    const int nlast = static_cast<int>(m_uniform_polar.size()) - 1;
+    const amrex::Real aoa0 = m_uniform_aoa0;
+    const amrex::Real dinv = m_uniform_dinv;
+    const auto* polar = m_uniform_polar.data();
+    const auto* aptr = aoa.data();
+    auto* clptr = cl.data();
+    auto* cdptr = cd.data();
+    for (int i = 0; i < npts; ++i) {
+        const amrex::Real xa = amrex::min<amrex::Real>(
+            amrex::max<amrex::Real>((aptr[i] - aoa0) * dinv, 0.0), nlast);
+        const int idx = amrex::min(static_cast<int>(xa), nlast - 1);
+        const amrex::Real facR = xa - idx;
+        clptr[i] = (1.0 - facR) * polar[idx].x() + facR * polar[idx + 1].x();
+        cdptr[i] = (1.0 - facR) * polar[idx].y() + facR * polar[idx + 1].y();
+    }
+}
+
+void AirfoilTable::resample_uniform(const amrex::Real daoa)
+{
+    AMREX_ALWAYS_ASSERT(daoa > 0.0);
+    AMREX_ALWAYS_ASSERT(m_aoa.size() > 1);
+    m_uniform = false;
+
+    const amrex::Real aoa0 = m_aoa.front();
+    const amrex::Real range = m_aoa.back() - aoa0;
+    AMREX_ALWAYS_ASSERT(range > 0.0);
+    const int nintervals =
+        amrex::max(1, static_cast<int>(std::ceil(range / daoa - 1.0e-8)));
+    const amrex::Real dx = range / nintervals;
+
+    m_uniform_polar.resize(nintervals + 1);
+    for (int i = 0; i <= nintervals; ++i) {
+        m_uniform_polar[i] = interpolate(aoa0 + i * dx);
+    }
+    m_uniform_aoa0 = aoa0;
+    m_uniform_dinv = 1.0 / dx;
+    m_uniform = true;
+}
+
 void ThinAirfoil::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
@@ -42,6 +116,16 @@ void ThinAirfoil::operator()(
     cd = m_cd_factor * std::sin(aoa);
 }
 
+void ThinAirfoil::lookup(const RealList& aoa, RealList& cl, RealList& cd) const
+{
+    const int npts = aoa.size();
+    cl.resize(npts);
+    cd.resize(npts);
+    for (int i = 0; i < npts; ++i) {
+        (*this)(aoa[i], cl[i], cd[i]);
+    }
+}
+
 void AirfoilTable::convert_aoa_to_radians()
 {
     std::transform(
@@ -39,12 +39,29 @@ inline void copy_filename(const std::string& inp, char* out)
     out[len] = '\0';
 }
 
+inline void check_elapsed_time(const FastTurbine& fi)
+{
+    const auto& tmax = fi.stop_time;
+    const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
+    if (telapsed > (tmax + 1.0e-8)) {
+        // clang-format off
+        amrex::OutStream()
+            << "\nWARNING: FastIface:\n"
+            << "  Elapsed simulation time will exceed max "
+            << "time set for OpenFAST"
+            << std::endl << std::endl;
+        // clang-format on
+    }
+}
+
 } // namespace
 
 FastIface::FastIface(const amr_wind::CFDSim& /*unused*/) {}
 
 FastIface::~FastIface()
 {
+    wait_all();
+
     int ierr = ErrID_None;
     char err_msg[fast_strlen()];
     FAST_DeallocateTurbines(&ierr, err_msg);
@@ -141,26 +158,66 @@ void FastIface::advance_turbine(const int local_id)
 
     auto& fi = *m_turbine_data[local_id];
     AMREX_ASSERT(!fi.is_solution0);
-    {
-        const auto& tmax = fi.stop_time;
-        const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
-        if (telapsed > (tmax + 1.0e-8)) {
-            // clang-format off
-            amrex::OutStream()
-                << "\nWARNING: FastIface:\n"
-                << "  Elapsed simulation time will exceed max "
-                << "time set for OpenFAST"
-                << std::endl << std::endl;
-            // clang-format on
-        }
-    }
+    check_elapsed_time(fi);
 
     write_velocity_data(fi);
+    step_turbine(fi);
+}
+
+void FastIface::step_turbine(FastTurbine& fi)
+{
     for (int i = 0; i < fi.num_substeps; ++i, ++fi.time_index) {
         fast_func(FAST_OpFM_Step, &fi.tid_local);
     }
 }
 
+void FastIface::advance_turbine_async(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine_async");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+    wait_turbine(local_id);
+
+    auto& fi = *m_turbine_data[local_id];
+    AMREX_ASSERT(!fi.is_solution0);
+    check_elapsed_time(fi);
+
+    // Velocity output and profiling are kept on the calling thread, the
+    // helper thread only performs the OpenFAST substeps
+    write_velocity_data(fi);
+    FastTurbine* fptr = &fi;
+    m_pending[local_id] = std::async(std::launch::async, [this, fptr]() {
+        std::lock_guard<std::mutex> lock(m_fast_mutex);
+        step_turbine(*fptr);
+    });
+}
+
+void FastIface::wait_turbine(const int local_id)
+{
+    auto it = m_pending.find(local_id);
+    if (it == m_pending.end()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::FastIface::wait_turbine");
+    auto fut = std::move(it->second);
+    m_pending.erase(it);
+    if (fut.valid()) {
+        fut.get();
+    }
+}
+
+void FastIface::wait_all()
+{
+    while (!m_pending.empty()) {
+        wait_turbine(m_pending.begin()->first);
+    }
+}
+
+bool FastIface::is_pending(const int local_id) const
+{
+    return (m_pending.find(local_id) != m_pending.end());
+}
+
 void FastIface::init_turbine(const int local_id)
 {
     AMREX_ALWAYS_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
@@ -1,4 +1,5 @@
 #include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
 #include "amr-wind/core/field_ops.H"
 
 namespace amr_wind_tests {
@@ -221,17 +222,39 @@ TEST_F(FieldRepoTest, field_advance_states)
 
     velocity.setVal(amrex::Vector<amrex::Real>{vx, vy, vz});
     vel_old.setVal(std::numeric_limits<amrex::Real>::max());
-    field_repo.advance_states();
 
     const int nlevels = field_repo.num_active_levels();
+    amrex::Vector<const amrex::MultiFab*> new_addr(nlevels);
+    amrex::Vector<const amrex::MultiFab*> old_addr(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        new_addr[lev] = &velocity(lev);
+        old_addr[lev] = &vel_old(lev);
+    }
+
+    velocity.in_uniform_space() = true;
+    vel_old.in_uniform_space() = false;
+    field_repo.advance_states();
+
+    // States are rotated: old holds the previous new data and vice versa
+    const amrex::Vector<amrex::Real> vel{vx, vy, vz};
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_EQ(&velocity(lev), new_addr[lev]);
+        EXPECT_EQ(&vel_old(lev), old_addr[lev]);
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            EXPECT_NEAR(vel_old(lev).min(i), vel[i], 1.0e-12);
+            EXPECT_NEAR(vel_old(lev).max(i), vel[i], 1.0e-12);
+            EXPECT_EQ(
+                velocity(lev).min(i), std::numeric_limits<amrex::Real>::max());
+        }
+    }
+    EXPECT_TRUE(vel_old.in_uniform_space());
+    EXPECT_FALSE(velocity.in_uniform_space());
+
+    velocity.copy_state(amr_wind::FieldState::New, amr_wind::FieldState::Old);
     for (int lev = 0; lev < nlevels; ++lev) {
         for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-            const auto old_min = vel_old(lev).min(i);
-            const auto old_max = vel_old(lev).max(i);
-            const auto new_min = velocity(lev).min(i);
-            const auto new_max = velocity(lev).max(i);
-            EXPECT_NEAR(old_min, new_min, 1.0e-12);
-            EXPECT_NEAR(old_max, new_max, 1.0e-12);
+            EXPECT_NEAR(velocity(lev).min(i), vel[i], 1.0e-12);
+            EXPECT_NEAR(velocity(lev).max(i), vel[i], 1.0e-12);
         }
     }
 }
@@ -312,6 +335,58 @@ TEST_F(FieldRepoTest, scratch_fields)
     }
 }
 
+TEST_F(FieldRepoTest, scratch_field_pool)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    const auto& stats = frepo.scratch_pool().stats();
+    const amrex::Long hits = stats.hits;
+    const amrex::Long misses = stats.misses;
+    const int nlevels = frepo.num_active_levels();
+
+    amrex::Vector<amrex::BoxArray> ba(nlevels);
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            ba[lev] = (*sfield)(lev).boxArray();
+        }
+    }
+    EXPECT_EQ(stats.misses, misses + nlevels);
+    EXPECT_EQ(stats.hits, hits);
+    EXPECT_GT(stats.bytes, 0);
+    const amrex::Long bytes = stats.bytes;
+
+    // Same shape is served from the pool
+    {
+        auto sfield = frepo.create_scratch_field("recycled", 3, 1);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            EXPECT_EQ((*sfield)(lev).boxArray(), ba[lev]);
+            EXPECT_EQ((*sfield)(lev).nComp(), 3);
+            EXPECT_EQ((*sfield)(lev).nGrow(), 1);
+        }
+
+        // A buffer in use is not handed out twice
+        auto sfield2 = frepo.create_scratch_field(3, 1);
+        if ((*sfield)(0).local_size() > 0) {
+            EXPECT_NE((*sfield)(0)[0].dataPtr(), (*sfield2)(0)[0].dataPtr());
+        }
+    }
+    EXPECT_EQ(stats.hits, hits + nlevels);
+    EXPECT_EQ(stats.misses, misses + 2 * nlevels);
+    EXPECT_GE(stats.peak_bytes, 2 * bytes);
+
+    // Different shapes do not share buffers
+    {
+        auto sfield = frepo.create_scratch_field(3, 0);
+        auto nfield =
+            frepo.create_scratch_field(3, 1, amr_wind::FieldLoc::NODE);
+        EXPECT_EQ((*nfield)(0).ixType(), amrex::IndexType::TheNodeType());
+    }
+    EXPECT_EQ(stats.hits, hits + nlevels);
+    EXPECT_EQ(stats.misses, misses + 4 * nlevels);
+}
+
 TEST_F(FieldRepoTest, int_fields)
 {
     initialize_mesh();
@@ -387,4 +462,78 @@ TEST_F(FieldRepoTest, field_subviews)
     }
 }
 
+TEST_F(FieldRepoTest, cached_gradient)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& velocity = frepo.declare_field("vel", 3, 1, 2);
+    auto& vel_old = velocity.state(amr_wind::FieldState::Old);
+
+    // Linear velocity field including ghost cells, so the central
+    // differences are exact everywhere
+    auto init_vel = [&](const amrex::Real fac) {
+        run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& dx = mesh().Geom(lev).CellSizeArray();
+            const auto& vel = velocity(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    vel(i, j, k, 0) = fac * (i + 0.5) * dx[0];
+                    vel(i, j, k, 1) = 2.0 * fac * (j + 0.5) * dx[1];
+                    vel(i, j, k, 2) = 3.0 * fac * (k + 0.5) * dx[2];
+                });
+        });
+    };
+
+    auto check_grad = [&](const amr_wind::Field& grad, const amrex::Real fac) {
+        const int nlevels = frepo.num_active_levels();
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                const int n = i * AMREX_SPACEDIM + i;
+                EXPECT_NEAR(grad(lev).min(n), (i + 1) * fac, 1.0e-12);
+                EXPECT_NEAR(grad(lev).max(n), (i + 1) * fac, 1.0e-12);
+            }
+        }
+    };
+
+    init_vel(1.0);
+    velocity.mark_modified();
+    const auto& grad = frepo.cached_gradient(velocity);
+    EXPECT_EQ(grad.num_comp(), 9);
+    check_grad(grad, 1.0);
+
+    // Writes that are not flagged are not seen by the cache
+    const auto version = velocity.data_version();
+    init_vel(2.0);
+    const auto& grad_cached = frepo.cached_gradient(velocity);
+    EXPECT_EQ(&grad_cached, &grad);
+    EXPECT_EQ(velocity.data_version(), version);
+    check_grad(grad_cached, 1.0);
+
+    // Flagged writes trigger a recompute into the same storage
+    velocity.mark_modified();
+    EXPECT_NE(velocity.data_version(), version);
+    const auto& grad_new = frepo.cached_gradient(velocity);
+    EXPECT_EQ(&grad_new, &grad);
+    check_grad(grad_new, 2.0);
+
+    // After state rotation the old state reuses the gradient of the
+    // previous new state
+    const auto new_version = velocity.data_version();
+    frepo.advance_states();
+    EXPECT_EQ(vel_old.data_version(), new_version);
+    const auto& grad_old = frepo.cached_gradient(vel_old);
+    EXPECT_EQ(&grad_old, &grad);
+    check_grad(grad_old, 2.0);
+
+    // Bulk updates also invalidate the cache
+    velocity.setVal(1.0);
+    const auto& grad_const = frepo.cached_gradient(velocity);
+    EXPECT_NE(&grad_const, &grad_old);
+    for (int lev = 0; lev < frepo.num_active_levels(); ++lev) {
+        EXPECT_NEAR(grad_const(lev).norm0(), 0.0, 1.0e-12);
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,56 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/MeshMapArray.H"
+
+namespace amr_wind_tests {
+
+class MeshMapArrayTest : public MeshTest
+{};
+
+TEST_F(MeshMapArrayTest, map_array_views)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& fac = frepo.declare_field("mesh_fac", 3, 0, 1);
+    auto& out = frepo.declare_field("out", 2, 0, 1);
+    fac.setVal(2.0);
+    out.setVal(0.0);
+
+    const int nlevels = frepo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi(out(lev)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& out_arr = out(lev).array(mfi);
+            const amr_wind::mesh_map::MapArray<true> mapped(
+                fac(lev).const_array(mfi));
+            const amr_wind::mesh_map::MapArray<false> uniform(
+                fac(lev).const_array(mfi));
+
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    out_arr(i, j, k, 0) = mapped(i, j, k, 1);
+                    out_arr(i, j, k, 1) = uniform(i, j, k, 1);
+                });
+        }
+
+        EXPECT_NEAR(out(lev).min(0), 2.0, 1.0e-12);
+        EXPECT_NEAR(out(lev).max(0), 2.0, 1.0e-12);
+        EXPECT_NEAR(out(lev).min(1), 1.0, 1.0e-12);
+        EXPECT_NEAR(out(lev).max(1), 1.0, 1.0e-12);
+    }
+
+    const amr_wind::mesh_map::MapMultiArray<true> mapped_all(
+        fac(0).const_arrays());
+    const amr_wind::mesh_map::MapMultiArray<false> uniform_all(
+        fac(0).const_arrays());
+    const amrex::Real sum = amrex::ParReduce(
+        amrex::TypeList<amrex::ReduceOpSum>{}, amrex::TypeList<amrex::Real>{},
+        fac(0), amrex::IntVect(0),
+        [=] AMREX_GPU_HOST_DEVICE(int box_no, int i, int j, int k)
+            -> amrex::GpuTuple<amrex::Real> {
+            return mapped_all[box_no](i, j, k, 2) -
+                   2.0 * uniform_all[box_no](i, j, k);
+        });
+    EXPECT_NEAR(sum, 0.0, 1.0e-12);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,63 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/TileWorkspace.H"
+
+namespace amr_wind_tests {
+
+class TileWorkspaceTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 4);
+        pp.add("blocking_factor", 4);
+    }
+};
+
+TEST_F(TileWorkspaceTest, tile_slots)
+{
+    initialize_mesh();
+    auto& frepo = mesh().field_repo();
+    auto& phi = frepo.declare_field("phi", 1, 1, 1);
+
+    amr_wind::TileWorkspace workspace;
+    workspace.prepare(phi(0), 1, 2);
+    EXPECT_GE(workspace.num_slots(), 1);
+    EXPECT_EQ(workspace.slot_size(), 6 * 6 * 6 * 2);
+
+    // The storage never shrinks
+    workspace.prepare(phi(0), 0, 1);
+    EXPECT_EQ(workspace.slot_size(), 6 * 6 * 6 * 2);
+
+#ifdef _OPENMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(phi(0), amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& gbx = amrex::grow(bx, 1);
+        const auto tmp =
+            amrex::makeArray4(workspace.slot(gbx, 2, true), gbx, 2);
+        const auto& phi_arr = phi(0).array(mfi);
+
+        amrex::ParallelFor(
+            gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                tmp(i, j, k, 1) += 1.0 + tmp(i, j, k, 0);
+            });
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                phi_arr(i, j, k) = tmp(i - 1, j, k, 1) + tmp(i, j, k + 1, 1);
+            });
+    }
+
+    EXPECT_NEAR(phi(0).min(0), 2.0, 1.0e-12);
+    EXPECT_NEAR(phi(0).max(0), 2.0, 1.0e-12);
+
+    // Larger requests grow the slots
+    workspace.prepare(phi(0), 2, 2);
+    EXPECT_EQ(workspace.slot_size(), 8 * 8 * 8 * 2);
+}
+
+} // namespace amr_wind_tests
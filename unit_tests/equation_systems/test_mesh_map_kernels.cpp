@@ -0,0 +1,404 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+#include "amr-wind/equation_systems/CompRHSOps.H"
+#include "amr-wind/equation_systems/icns/icns.H"
+#include "amr-wind/equation_systems/temperature/temperature.H"
+#include "amr-wind/utilities/cfl_utils.H"
+
+namespace amr_wind_tests {
+
+class MeshMapKernelsTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{m_nx, m_nx, m_nx}};
+            pp.addarr("n_cell", ncell);
+            pp.add("max_grid_size", m_mgs);
+        }
+        {
+            amrex::ParmParse pp("incflo");
+            pp.add("use_godunov", 0);
+        }
+    }
+
+    //! Register the PDEs and initialize all fields used by the kernels
+    void setup_fields()
+    {
+        initialize_mesh();
+
+        auto& repo = sim().repo();
+        auto& pde_mgr = sim().pde_manager();
+        pde_mgr.register_icns();
+        pde_mgr.register_transport_pde("Temperature");
+
+        auto& fac = repo.declare_field("mesh_scaling_factor_cc", 3, 1);
+        auto& detJ = repo.declare_field("mesh_scaling_detJ_cc", 1, 1);
+        auto& mask = repo.declare_int_field("mask_cell", 1, 1);
+        repo.declare_field("rhs_ref", AMREX_SPACEDIM);
+
+        // Smooth, strongly stretched mapping
+        const auto& geom = mesh().Geom();
+        run_algorithm(fac, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& problo = geom[lev].ProbLoArray();
+            const auto& dx = geom[lev].CellSizeArray();
+            const auto& fac_arr = fac(lev).array(mfi);
+            const auto& detJ_arr = detJ(lev).array(mfi);
+            const auto& mask_arr = mask(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                    const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                    fac_arr(i, j, k, 0) = 1.0 + 0.5 * std::sin(0.7 * x);
+                    fac_arr(i, j, k, 1) = 1.0 + 0.3 * std::cos(0.4 * y);
+                    fac_arr(i, j, k, 2) = 0.5 + 0.1 * z;
+                    detJ_arr(i, j, k) = fac_arr(i, j, k, 0) *
+                                        fac_arr(i, j, k, 1) *
+                                        fac_arr(i, j, k, 2);
+                    mask_arr(i, j, k) = ((i + j + k) % 3 == 0) ? 0 : 1;
+                });
+        });
+
+        auto& icns = pde_mgr.icns().fields();
+        auto& temp = pde_mgr.scalar_eqns()[0]->fields();
+        auto& density = repo.get_field("density");
+        init_field(density.state(amr_wind::FieldState::Old), 1.2);
+        init_field(density.state(amr_wind::FieldState::New), 1.3);
+        for (auto* fields : {&icns, &temp}) {
+            init_field(fields->field.state(amr_wind::FieldState::Old), 0.5);
+            init_field(fields->mueff, 1.0e-2);
+            init_field(fields->src_term, 0.2);
+            init_field(fields->diff_term.state(amr_wind::FieldState::Old), 0.3);
+            init_field(fields->diff_term.state(amr_wind::FieldState::New), 0.4);
+            init_field(fields->conv_term.state(amr_wind::FieldState::Old), 0.6);
+            init_field(fields->conv_term.state(amr_wind::FieldState::New), 0.7);
+        }
+    }
+
+    static void init_field(amr_wind::Field& fld, const amrex::Real offset)
+    {
+        const auto& geom = fld.repo().mesh().Geom();
+        const int ncomp = fld.num_comp();
+        run_algorithm(fld, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& problo = geom[lev].ProbLoArray();
+            const auto& dx = geom[lev].CellSizeArray();
+            const auto& arr = fld(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, ncomp,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                    const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                    arr(i, j, k, n) =
+                        offset +
+                        0.1 * std::sin(0.3 * x + n) * std::cos(0.2 * y) +
+                        0.05 * z;
+                });
+        });
+    }
+
+    int m_nx{16};
+    int m_mgs{8};
+};
+
+namespace {
+
+/** RHS kernel with runtime mesh mapping and overset checks in every cell
+ *
+ *  Reference implementation used to check the specialized kernels in
+ *  ComputeRHSOp.
+ */
+void generic_rhs(
+    amr_wind::pde::PDEFields& fields,
+    amr_wind::Field& out,
+    const bool mesh_mapping,
+    const bool has_overset,
+    const bool multiply_rho,
+    const bool corrector,
+    const amr_wind::DiffusionType difftype,
+    const amrex::Real dt)
+{
+    const bool explicit_diff = (difftype == amr_wind::DiffusionType::Explicit);
+    const amrex::Real factor = explicit_diff ? 1.0 : 0.5;
+    const amrex::Real ofac = 0.5;
+    const amrex::Real nfac = explicit_diff ? 0.5 : 0.0;
+
+    auto& repo = fields.repo;
+    const auto& field_old = fields.field.state(amr_wind::FieldState::Old);
+    const auto& density = repo.get_field("density");
+    const auto& den_new = density.state(amr_wind::FieldState::New);
+    const auto& den_old = density.state(amr_wind::FieldState::Old);
+    const auto& diff_new = fields.diff_term.state(amr_wind::FieldState::New);
+    const auto& diff_old = fields.diff_term.state(amr_wind::FieldState::Old);
+    const auto& conv_new = fields.conv_term.state(amr_wind::FieldState::New);
+    const auto& conv_old = fields.conv_term.state(amr_wind::FieldState::Old);
+    const auto& mask_cell = repo.get_int_field("mask_cell");
+    const auto& mesh_detJ =
+        repo.get_mesh_mapping_detJ(amr_wind::FieldLoc::CELL);
+    const int ncomp = fields.field.num_comp();
+
+    run_algorithm(out, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& fld = out(lev).array(mfi);
+        const auto& fld_o = field_old(lev).const_array(mfi);
+        const auto& rho_o = den_old(lev).const_array(mfi);
+        const auto& rho = den_new(lev).const_array(mfi);
+        const auto& src = fields.src_term(lev).const_array(mfi);
+        const auto& diff = diff_new(lev).const_array(mfi);
+        const auto& diff_o = diff_old(lev).const_array(mfi);
+        const auto& ddt = conv_new(lev).const_array(mfi);
+        const auto& ddt_o = conv_old(lev).const_array(mfi);
+        const auto& imask = mask_cell(lev).const_array(mfi);
+        const auto& detJ = mesh_detJ(lev).const_array(mfi);
+
+        amrex::ParallelFor(
+            bx, ncomp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                const amrex::Real det_j = mesh_mapping ? detJ(i, j, k) : 1.0;
+                const amrex::Real rho_old = multiply_rho ? rho_o(i, j, k) : 1.0;
+                const amrex::Real mask =
+                    has_overset ? static_cast<amrex::Real>(imask(i, j, k))
+                                : 1.0;
+
+                const amrex::Real terms =
+                    corrector
+                        ? (0.5 * (ddt_o(i, j, k, n) + ddt(i, j, k, n)) +
+                           ofac * diff_o(i, j, k, n) + nfac * diff(i, j, k, n))
+                        : (ddt_o(i, j, k, n) + factor * diff_o(i, j, k, n));
+
+                fld(i, j, k, n) = rho_old * det_j * fld_o(i, j, k, n) +
+                                  mask * dt * (terms + det_j * src(i, j, k, n));
+
+                if (multiply_rho) {
+                    fld(i, j, k, n) /= rho(i, j, k);
+                }
+
+                if (mesh_mapping && explicit_diff) {
+                    fld(i, j, k, n) /= det_j;
+                }
+            });
+    });
+}
+
+/** CFL reduction with runtime mesh mapping checks in every cell
+ *
+ *  Reference implementation used to check the specialized kernels in
+ *  amr_wind::cfl::compute_cfl_lev.
+ */
+amrex::GpuArray<amrex::Real, 3> generic_cfl(
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxinv,
+    const amrex::MultiFab& vel,
+    const amrex::MultiFab& vel_force,
+    const amrex::MultiFab& mu,
+    const amrex::MultiFab& rho,
+    const amrex::MultiFab& mesh_fac,
+    const bool mesh_mapping)
+{
+    const auto& vel_arr = vel.const_arrays();
+    const auto& vf_arr = vel_force.const_arrays();
+    const auto& mu_arr = mu.const_arrays();
+    const auto& rho_arr = rho.const_arrays();
+    const auto& fac_arr = mesh_fac.const_arrays();
+
+    const auto cfl = amrex::ParReduce(
+        amrex::TypeList<
+            amrex::ReduceOpMax, amrex::ReduceOpMax, amrex::ReduceOpMax>{},
+        amrex::TypeList<amrex::Real, amrex::Real, amrex::Real>{}, vel,
+        amrex::IntVect(0),
+        [=] AMREX_GPU_HOST_DEVICE(int box_no, int i, int j, int k)
+            -> amrex::GpuTuple<amrex::Real, amrex::Real, amrex::Real> {
+            const auto& v_bx = vel_arr[box_no];
+            const auto& vf_bx = vf_arr[box_no];
+            amrex::Real conv = 0.0;
+            amrex::Real diff = 0.0;
+            amrex::Real force = 0.0;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                const amrex::Real fac =
+                    mesh_mapping ? fac_arr[box_no](i, j, k, d) : 1.0;
+                const amrex::Real idx = dxinv[d] / fac;
+                conv =
+                    amrex::max(conv, amrex::Math::abs(v_bx(i, j, k, d)) * idx);
+                force = amrex::max(
+                    force, amrex::Math::abs(vf_bx(i, j, k, d)) * idx);
+                diff += 2.0 * idx * idx;
+            }
+            diff *= mu_arr[box_no](i, j, k) / rho_arr[box_no](i, j, k);
+            return {conv, diff, force};
+        });
+
+    return {amrex::get<0>(cfl), amrex::get<1>(cfl), amrex::get<2>(cfl)};
+}
+
+//! Largest difference between the valid cells of two fields
+amrex::Real max_diff(
+    const amr_wind::Field& fld, const amr_wind::Field& ref, const int ncomp)
+{
+    amrex::Real diff = 0.0;
+    const int nlevels = fld.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab err(
+            fld(lev).boxArray(), fld(lev).DistributionMap(), ncomp, 0);
+        amrex::MultiFab::Copy(err, ref(lev), 0, 0, ncomp, 0);
+        amrex::MultiFab::Subtract(err, fld(lev), 0, 0, ncomp, 0);
+        for (int icomp = 0; icomp < ncomp; ++icomp) {
+            diff = amrex::max(diff, err.norm0(icomp));
+        }
+    }
+    return diff;
+}
+
+//! Compare the specialized RHS kernels against the generic reference
+template <typename PDE>
+void check_rhs(
+    amr_wind::pde::PDEFields& fields,
+    amr_wind::Field& ref,
+    const bool mesh_mapping,
+    const bool has_overset)
+{
+    constexpr double tol = 1.0e-12;
+    constexpr amrex::Real dt = 0.1;
+    amr_wind::pde::ComputeRHSOp<PDE, amr_wind::fvm::MOL> rhs_op(fields);
+
+    for (const auto difftype :
+         {amr_wind::DiffusionType::Explicit,
+          amr_wind::DiffusionType::Crank_Nicolson}) {
+        rhs_op.predictor_rhs(difftype, dt, mesh_mapping, has_overset);
+        generic_rhs(
+            fields, ref, mesh_mapping, has_overset, PDE::multiply_rho, false,
+            difftype, dt);
+        EXPECT_NEAR(max_diff(fields.field, ref, PDE::ndim), 0.0, tol);
+
+        rhs_op.corrector_rhs(difftype, dt, mesh_mapping, has_overset);
+        generic_rhs(
+            fields, ref, mesh_mapping, has_overset, PDE::multiply_rho, true,
+            difftype, dt);
+        EXPECT_NEAR(max_diff(fields.field, ref, PDE::ndim), 0.0, tol);
+    }
+}
+
+} // namespace
+
+TEST_F(MeshMapKernelsTest, rhs_specialized_matches_generic)
+{
+    setup_fields();
+
+    auto& repo = sim().repo();
+    auto& pde_mgr = sim().pde_manager();
+    auto& icns = pde_mgr.icns().fields();
+    auto& temp = pde_mgr.scalar_eqns()[0]->fields();
+    auto& ref = repo.get_field("rhs_ref");
+
+    for (const bool mesh_mapping : {true, false}) {
+        for (const bool has_overset : {true, false}) {
+            check_rhs<amr_wind::pde::ICNS>(
+                icns, ref, mesh_mapping, has_overset);
+            check_rhs<amr_wind::pde::Temperature>(
+                temp, ref, mesh_mapping, has_overset);
+        }
+    }
+}
+
+TEST_F(MeshMapKernelsTest, cfl_specialized_matches_generic)
+{
+    constexpr double tol = 1.0e-12;
+    setup_fields();
+
+    auto& repo = sim().repo();
+    auto& fields = sim().pde_manager().icns().fields();
+    const auto& vel = fields.field.state(amr_wind::FieldState::Old);
+    const auto& rho = repo.get_field("density");
+    const auto& fac = repo.get_mesh_mapping_field(amr_wind::FieldLoc::CELL);
+
+    const int nlevels = repo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto dxinv = mesh().Geom(lev).InvCellSizeArray();
+        const auto mapped = amr_wind::cfl::compute_cfl_lev<true>(
+            dxinv, vel(lev), fields.src_term(lev), fields.mueff(lev), rho(lev),
+            nullptr, &fac(lev), true, true);
+        const auto uniform = amr_wind::cfl::compute_cfl_lev<false>(
+            dxinv, vel(lev), fields.src_term(lev), fields.mueff(lev), rho(lev),
+            nullptr, nullptr, true, true);
+        const auto mapped_ref = generic_cfl(
+            dxinv, vel(lev), fields.src_term(lev), fields.mueff(lev), rho(lev),
+            fac(lev), true);
+        const auto uniform_ref = generic_cfl(
+            dxinv, vel(lev), fields.src_term(lev), fields.mueff(lev), rho(lev),
+            fac(lev), false);
+
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_NEAR(mapped[i], mapped_ref[i], tol);
+            EXPECT_NEAR(uniform[i], uniform_ref[i], tol);
+        }
+        // The stretched mesh must actually change the estimates
+        EXPECT_GT(std::abs(mapped[0] - uniform[0]), 1.0e-3);
+    }
+}
+
+// CPU throughput of the specialized kernels against the generic ones on a
+// uniform mesh, run with --gtest_also_run_disabled_tests
+TEST_F(MeshMapKernelsTest, DISABLED_benchmark)
+{
+    constexpr int nrep = 20;
+    constexpr amrex::Real dt = 0.1;
+    m_nx = 64;
+    m_mgs = 32;
+    setup_fields();
+
+    auto& repo = sim().repo();
+    auto& fields = sim().pde_manager().icns().fields();
+    auto& ref = repo.get_field("rhs_ref");
+    const auto& vel = fields.field.state(amr_wind::FieldState::Old);
+    const auto& rho = repo.get_field("density");
+    const auto& fac = repo.get_mesh_mapping_field(amr_wind::FieldLoc::CELL);
+    const auto dxinv = mesh().Geom(0).InvCellSizeArray();
+    const amrex::Real ncells =
+        static_cast<amrex::Real>(mesh().boxArray(0).numPts()) * nrep;
+    amr_wind::pde::ComputeRHSOp<amr_wind::pde::ICNS, amr_wind::fvm::MOL>
+        rhs_op(fields);
+
+    amrex::Gpu::synchronize();
+    const amrex::Real t0 = amrex::second();
+    for (int n = 0; n < nrep; ++n) {
+        rhs_op.predictor_rhs(
+            amr_wind::DiffusionType::Crank_Nicolson, dt, false, false);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t1 = amrex::second();
+    for (int n = 0; n < nrep; ++n) {
+        generic_rhs(
+            fields, ref, false, false, false, false,
+            amr_wind::DiffusionType::Crank_Nicolson, dt);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t2 = amrex::second();
+    for (int n = 0; n < nrep; ++n) {
+        amr_wind::cfl::compute_cfl_lev<false>(
+            dxinv, vel(0), fields.src_term(0), fields.mueff(0), rho(0),
+            nullptr, nullptr, true, true);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t3 = amrex::second();
+    for (int n = 0; n < nrep; ++n) {
+        generic_cfl(
+            dxinv, vel(0), fields.src_term(0), fields.mueff(0), rho(0), fac(0),
+            false);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t4 = amrex::second();
+
+    amrex::Print() << "predictor_rhs: specialized " << ncells / (t1 - t0)
+                   << " cells/s, generic " << ncells / (t2 - t1) << " cells/s"
+                   << std::endl;
+    amrex::Print() << "cfl: specialized " << ncells / (t3 - t2)
+                   << " cells/s, generic " << ncells / (t4 - t3) << " cells/s"
+                   << std::endl;
+}
+
+} // namespace amr_wind_tests
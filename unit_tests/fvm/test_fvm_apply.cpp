@@ -0,0 +1,168 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+#include "aw_test_utils/test_utils.H"
+#include "amr-wind/fvm/gradient.H"
+#include "amr-wind/fvm/laplacian.H"
+#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/fvm/vorticity_mag.H"
+
+namespace amr_wind_tests {
+
+class FvmApplyTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{m_nx, m_nx, m_nx}};
+            pp.addarr("n_cell", ncell);
+            pp.add("max_grid_size", m_mgs);
+            pp.add("blocking_factor", m_mgs);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<int> periodic{{0, 1, 0}};
+            pp.addarr("is_periodic", periodic);
+        }
+    }
+
+    void init_velocity(amr_wind::Field& vel)
+    {
+        const auto& geom = mesh().Geom();
+        run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& problo = geom[lev].ProbLoArray();
+            const auto& dx = geom[lev].CellSizeArray();
+            const auto& vel_arr = vel(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                    const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                    vel_arr(i, j, k, 0) = std::sin(0.3 * x) * std::cos(z);
+                    vel_arr(i, j, k, 1) = x * y - 0.2 * z * z;
+                    vel_arr(i, j, k, 2) = std::exp(-0.1 * (x + y)) * z;
+                });
+        });
+    }
+
+    int m_nx{8};
+    int m_mgs{4};
+};
+
+namespace {
+
+//! Apply an operator with both paths and return the largest difference
+template <typename FvmOp>
+amrex::Real apply_diff(
+    const amr_wind::Field& vel, amr_wind::Field& res, amr_wind::Field& ref)
+{
+    FvmOp op_single(res, vel);
+    amr_wind::fvm::impl::apply(op_single, vel);
+    FvmOp op_ref(ref, vel);
+    amr_wind::fvm::impl::apply_per_stencil(op_ref, vel);
+
+    amrex::Real diff = 0.0;
+    const int nlevels = vel.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::Subtract(ref(lev), res(lev), 0, 0, ref.num_comp(), 0);
+        for (int icomp = 0; icomp < ref.num_comp(); ++icomp) {
+            diff = amrex::max(diff, ref(lev).norm0(icomp));
+        }
+    }
+    return diff;
+}
+
+//! Time repeated applications of an operator with both paths
+template <typename FvmOp>
+void time_paths(
+    const std::string& name,
+    const amr_wind::Field& vel,
+    amr_wind::Field& res,
+    const int nrep)
+{
+    FvmOp op(res, vel);
+
+    amrex::Gpu::synchronize();
+    const amrex::Real t0 = amrex::second();
+    for (int n = 0; n < nrep; ++n) {
+        amr_wind::fvm::impl::apply(op, vel);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t1 = amrex::second();
+    for (int n = 0; n < nrep; ++n) {
+        amr_wind::fvm::impl::apply_per_stencil(op, vel);
+    }
+    amrex::Gpu::synchronize();
+    const amrex::Real t2 = amrex::second();
+
+    amrex::Print() << name << ": single launch " << (t1 - t0) / nrep
+                   << " s, per stencil " << (t2 - t1) / nrep << " s"
+                   << std::endl;
+}
+
+} // namespace
+
+TEST_F(FvmApplyTest, single_launch_matches)
+{
+    constexpr double tol = 1.0e-12;
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("vel", AMREX_SPACEDIM, 1);
+    auto& grad = repo.declare_field("grad", AMREX_SPACEDIM * AMREX_SPACEDIM);
+    auto& grad_ref =
+        repo.declare_field("grad_ref", AMREX_SPACEDIM * AMREX_SPACEDIM);
+    auto& scalar = repo.declare_field("scalar", 1);
+    auto& scalar_ref = repo.declare_field("scalar_ref", 1);
+    init_velocity(vel);
+
+    using amr_wind::Field;
+    EXPECT_NEAR(
+        (apply_diff<amr_wind::fvm::Gradient<Field, Field>>(
+            vel, grad, grad_ref)),
+        0.0, tol);
+    EXPECT_NEAR(
+        (apply_diff<amr_wind::fvm::Laplacian<Field, Field>>(
+            vel, scalar, scalar_ref)),
+        0.0, tol);
+    EXPECT_NEAR(
+        (apply_diff<amr_wind::fvm::StrainRate<Field, Field>>(
+            vel, scalar, scalar_ref)),
+        0.0, tol);
+    EXPECT_NEAR(
+        (apply_diff<amr_wind::fvm::VorticityMag<Field, Field>>(
+            vel, scalar, scalar_ref)),
+        0.0, tol);
+}
+
+// Micro-benchmark on a grid of small boxes that all touch the domain
+// boundaries, run with --gtest_also_run_disabled_tests
+TEST_F(FvmApplyTest, DISABLED_benchmark)
+{
+    constexpr int nrep = 20;
+    m_nx = 32;
+    m_mgs = 8;
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("vel", AMREX_SPACEDIM, 1);
+    auto& grad = repo.declare_field("grad", AMREX_SPACEDIM * AMREX_SPACEDIM);
+    auto& scalar = repo.declare_field("scalar", 1);
+    init_velocity(vel);
+
+    using amr_wind::Field;
+    time_paths<amr_wind::fvm::Gradient<Field, Field>>(
+        "gradient", vel, grad, nrep);
+    time_paths<amr_wind::fvm::StrainRate<Field, Field>>(
+        "strainrate", vel, scalar, nrep);
+    time_paths<amr_wind::fvm::VorticityMag<Field, Field>>(
+        "vorticity_mag", vel, scalar, nrep);
+    time_paths<amr_wind::fvm::Laplacian<Field, Field>>(
+        "laplacian", vel, scalar, nrep);
+}
+
+} // namespace amr_wind_tests
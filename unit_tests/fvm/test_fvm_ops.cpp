@@ -7,6 +7,7 @@
 #include "amr-wind/fvm/laplacian.H"
 #include "amr-wind/fvm/divergence.H"
 #include "amr-wind/fvm/curvature.H"
+#include "amr-wind/fvm/velocity_invariants.H"
 #include "AnalyticalFunction.H"
 #include "aw_test_utils/iter_tools.H"
 #include "aw_test_utils/test_utils.H"
@@ -408,4 +409,63 @@ TEST_F(FvmOpTest, q_criterion)
     EXPECT_NEAR(error_total, 0.0, tol);
 }
 
+TEST_F(FvmOpTest, velocity_invariants)
+{
+    constexpr double tol = 1.0e-12;
+
+    populate_parameters();
+    {
+        amrex::ParmParse pp("geometry");
+        amrex::Vector<int> periodic{{0, 0, 0}};
+        pp.addarr("is_periodic", periodic);
+    }
+
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("vel", 3, 1);
+
+    const int pdegree = 2;
+    const int ncoeff = (pdegree + 1) * (pdegree + 1) * (pdegree + 1);
+    amrex::Gpu::DeviceVector<amrex::Real> cu(ncoeff, 0.00123);
+    amrex::Gpu::DeviceVector<amrex::Real> cv(ncoeff, 0.00213);
+    amrex::Gpu::DeviceVector<amrex::Real> cw(ncoeff, 0.00346);
+
+    const auto& geom = repo.mesh().Geom();
+    run_algorithm(vel, [&](const int lev, const amrex::MFIter& mfi) {
+        auto vel_arr = vel(lev).array(mfi);
+        const auto& bx = mfi.validbox();
+        initialize_velocity(geom[lev], bx, pdegree, cu, cv, cw, vel_arr);
+    });
+    vel.mark_modified();
+
+    const auto& gradvel = repo.cached_gradient(vel);
+    auto str = amr_wind::fvm::strainrate(vel);
+    auto vrt = amr_wind::fvm::vorticity_mag(vel);
+    auto qcrit = amr_wind::fvm::q_criterion(vel);
+    auto qcrit_nd = repo.create_scratch_field(1);
+    amr_wind::fvm::q_criterion(*qcrit_nd, vel, true);
+    auto div = amr_wind::fvm::divergence(vel);
+
+    auto& out = repo.declare_field("invariant_out", 1);
+    const int nlevels = repo.num_active_levels();
+    auto check = [&](const amr_wind::Field& ref) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            amrex::MultiFab::Subtract(out(lev), ref(lev), 0, 0, 1, 0);
+            EXPECT_NEAR(out(lev).norm0(), 0.0, tol);
+        }
+    };
+
+    amr_wind::fvm::strainrate_from_gradient(out, gradvel);
+    check(*str);
+    amr_wind::fvm::vorticity_mag_from_gradient(out, gradvel);
+    check(*vrt);
+    amr_wind::fvm::q_criterion_from_gradient(out, gradvel);
+    check(*qcrit);
+    amr_wind::fvm::q_criterion_from_gradient(out, gradvel, true);
+    check(*qcrit_nd);
+    amr_wind::fvm::divergence_from_gradient(out, gradvel);
+    check(*div);
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,98 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+#include "amr-wind/core/field_ops.H"
+#include "amr-wind/utilities/DerivedQuantity.H"
+
+namespace amr_wind_tests {
+
+class DerivedQtyTest : public MeshTest
+{
+protected:
+    //! Linear field including ghost cells, so central differences are exact
+    void init_linear(amr_wind::Field& fld, const amrex::Real fac)
+    {
+        run_algorithm(fld, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& dx = mesh().Geom(lev).CellSizeArray();
+            const auto& arr = fld(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    arr(i, j, k, 0) = fac * (i + 0.5) * dx[0];
+                    arr(i, j, k, 1) = 2.0 * fac * (j + 0.5) * dx[1];
+                    arr(i, j, k, 2) = 3.0 * fac * (k + 0.5) * dx[2];
+                });
+        });
+        fld.mark_modified();
+    }
+
+    //! Check the diagonal of the gradient and the divergence
+    void
+    check_grad_div(const amr_wind::ScratchField& fld, const amrex::Real fac)
+    {
+        const int nlevels = mesh().field_repo().num_active_levels();
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                const int n = i * AMREX_SPACEDIM + i;
+                EXPECT_NEAR(fld(lev).min(n), (i + 1) * fac, 1.0e-12);
+                EXPECT_NEAR(fld(lev).max(n), (i + 1) * fac, 1.0e-12);
+            }
+            const int ndiv = AMREX_SPACEDIM * AMREX_SPACEDIM;
+            EXPECT_NEAR(fld(lev).min(ndiv), 6.0 * fac, 1.0e-12);
+            EXPECT_NEAR(fld(lev).max(ndiv), 6.0 * fac, 1.0e-12);
+        }
+    }
+};
+
+TEST_F(DerivedQtyTest, gradient_tracks_field_ops)
+{
+    initialize_mesh();
+
+    auto& repo = mesh().field_repo();
+    auto& vel = repo.declare_field("vel", 3, 1);
+    auto& vel2 = repo.declare_field("vel2", 3, 1);
+    init_linear(vel, 1.0);
+    init_linear(vel2, 0.5);
+
+    amr_wind::DerivedQtyMgr derived(repo);
+    derived.create("grad(vel)");
+    derived.create("div(vel)");
+    auto fld = repo.create_scratch_field(derived.num_comp());
+    EXPECT_EQ(derived.num_comp(), AMREX_SPACEDIM * AMREX_SPACEDIM + 1);
+
+    // Populate the cached gradient of the original field
+    repo.cached_gradient(vel);
+    derived(*fld);
+    check_grad_div(*fld, 1.0);
+
+    // Modifications through field_ops are seen by the derived quantities and
+    // the gradient cache
+    auto version = vel.data_version();
+    amr_wind::field_ops::saxpy(vel, 1.0, vel2, 0, 0, 3, 1);
+    EXPECT_NE(vel.data_version(), version);
+    derived(*fld);
+    check_grad_div(*fld, 1.5);
+    EXPECT_NEAR(repo.cached_gradient(vel)(0).max(0), 1.5, 1.0e-12);
+
+    version = vel.data_version();
+    amr_wind::field_ops::lincomb(vel, 2.0, vel2, 0, 0.0, vel2, 0, 0, 3, 1);
+    EXPECT_NE(vel.data_version(), version);
+    derived(*fld);
+    check_grad_div(*fld, 1.0);
+
+    version = vel.data_version();
+    amr_wind::field_ops::copy(vel, vel2, 0, 0, 3, 1);
+    EXPECT_NE(vel.data_version(), version);
+    derived(*fld);
+    check_grad_div(*fld, 0.5);
+    EXPECT_NEAR(repo.cached_gradient(vel)(0).max(0), 0.5, 1.0e-12);
+
+    // Writes through a subview are recorded on the underlying field
+    version = vel.data_version();
+    auto vel_view = vel.subview(0, 3);
+    amr_wind::field_ops::saxpy(vel_view, 1.0, vel2, 0, 0, 3, 1);
+    EXPECT_NE(vel.data_version(), version);
+    derived(*fld);
+    check_grad_div(*fld, 1.0);
+}
+
+} // namespace amr_wind_tests
@@ -423,6 +423,15 @@ protected:
         pp.addarr("start", pl_start);
         pp.addarr("end", pl_end);
     }
+    void setup_grid2D_dense()
+    {
+        amrex::ParmParse pp("freesurface");
+        pp.add("output_frequency", 1);
+        pp.add("num_instances", 2);
+        pp.addarr("num_points", amrex::Vector<int>{npts_dense, npts_dense});
+        pp.addarr("start", plnarrow_s);
+        pp.addarr("end", pl_end);
+    }
     void setup_grid2D_narrow()
     {
         amrex::ParmParse pp("freesurface");
@@ -444,6 +453,7 @@ protected:
     const amrex::Vector<amrex::Real> plnarrow_s{{63.0, 63.0, 0.0}};
     const amrex::Vector<amrex::Real> plnarrow_e{{65.0, 65.0, 0.0}};
     const int npts = 3;
+    const int npts_dense = 41;
 };
 
 TEST_F(FreeSurfaceTest, point)
@@ -524,6 +534,29 @@ TEST_F(FreeSurfaceTest, multivalued)
     ASSERT_EQ(nout, npts * npts);
 }
 
+TEST_F(FreeSurfaceTest, plane_dense)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vof = repo.declare_field("vof", 1, 2);
+    // Several sampling points per cell column, including the upper boundary
+    setup_grid2D_dense();
+
+    amrex::Real liwl = init_vof(vof, water_level1);
+    auto& m_sim = sim();
+    FreeSurfaceImpl tool(m_sim, "freesurface");
+    tool.initialize();
+    tool.post_advance_work();
+
+    const int ngp = npts_dense * npts_dense;
+    EXPECT_EQ(tool.num_gridpoints(), ngp);
+    // Every point finds the interface, none is found below it
+    int nout = tool.check_output(0, "~", liwl);
+    ASSERT_EQ(nout, ngp);
+    nout = tool.check_output(1, "~", problo[2]);
+    ASSERT_EQ(nout, ngp);
+}
+
 TEST_F(FreeSurfaceTest, sloped)
 {
     initialize_mesh();
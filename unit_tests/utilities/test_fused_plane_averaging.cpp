@@ -0,0 +1,121 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/FieldPlaneAveraging.H"
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+#include "amr-wind/utilities/SecondMomentAveraging.H"
+#include "amr-wind/utilities/ThirdMomentAveraging.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+namespace amr_wind_tests {
+
+class FusedPlaneAveragingTest : public MeshTest
+{};
+
+namespace {
+
+void init_fields(
+    const amrex::Geometry& geom,
+    const amrex::Box& bx,
+    const amrex::Array4<amrex::Real>& vel,
+    const amrex::Array4<amrex::Real>& temp)
+{
+    const auto xlo = geom.ProbLoArray();
+    const auto xhi = geom.ProbHiArray();
+    const auto dx = geom.CellSizeArray();
+    const amrex::Real kx = amr_wind::utils::two_pi() / (xhi[0] - xlo[0]);
+
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const amrex::Real x = xlo[0] + (i + 0.5) * dx[0];
+        vel(i, j, k, 0) = 2.0 + std::cos(kx * x);
+        vel(i, j, k, 1) = 1.5;
+        vel(i, j, k, 2) = std::sin(kx * x);
+        temp(i, j, k) = 300.0 + std::cos(kx * x);
+    });
+}
+
+} // namespace
+
+TEST_F(FusedPlaneAveragingTest, fused_moments)
+{
+    constexpr double tol = 1.0e-12;
+    constexpr int dir = 2;
+
+    populate_parameters();
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& velocity = repo.declare_field("velocity", 3);
+    auto& temperature = repo.declare_field("temperature", 1);
+
+    run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+        init_fields(
+            mesh().Geom(lev), mfi.validbox(), velocity(lev).array(mfi),
+            temperature(lev).array(mfi));
+    });
+
+    // Averages from a single fused sweep
+    amr_wind::VelPlaneAveraging pa_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging pa_temp(temperature, sim().time(), dir);
+    amr_wind::FusedPlaneAveraging fused_mean;
+    fused_mean.add_average(pa_vel);
+    fused_mean.add_average(pa_temp);
+    EXPECT_EQ(fused_mean.num_terms(), 3);
+    fused_mean();
+
+    // Averages from individual sweeps
+    amr_wind::VelPlaneAveraging ref_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging ref_temp(temperature, sim().time(), dir);
+    ref_vel();
+    ref_temp();
+
+    const int ncell = pa_vel.ncell_line();
+    for (int i = 0; i < ncell * 3; ++i) {
+        EXPECT_NEAR(pa_vel.line_average()[i], ref_vel.line_average()[i], tol);
+    }
+    for (int i = 0; i < ncell; ++i) {
+        EXPECT_NEAR(
+            pa_vel.line_hvelmag_average()[i],
+            ref_vel.line_hvelmag_average()[i], tol);
+        EXPECT_NEAR(
+            pa_temp.line_average()[i], ref_temp.line_average()[i], tol);
+        EXPECT_NEAR(
+            pa_vel.line_derivative_of_average_cell(i, 0),
+            ref_vel.line_derivative_of_average_cell(i, 0), tol);
+        EXPECT_NEAR(pa_vel.line_average()[3 * i], 2.0, tol);
+    }
+
+    // Several moments sharing one sweep
+    amr_wind::FusedPlaneAveraging fused_stats;
+    amr_wind::SecondMomentAveraging tu(fused_stats, pa_vel, pa_temp);
+    amr_wind::SecondMomentAveraging uu(fused_stats, pa_vel, pa_vel);
+    amr_wind::ThirdMomentAveraging uuu(fused_stats, pa_vel, pa_vel, pa_vel);
+    EXPECT_EQ(fused_stats.num_terms(), 3);
+    fused_stats();
+
+    const auto& tu_line = tu.line_moment();
+    const auto& uu_line = uu.line_moment();
+    const auto& uuu_line = uuu.line_moment();
+    for (int i = 0; i < ncell; ++i) {
+        // <u'T'>, <v'T'>, <w'T'>
+        EXPECT_NEAR(tu_line[3 * i + 0], 0.5, tol);
+        EXPECT_NEAR(tu_line[3 * i + 1], 0.0, tol);
+        EXPECT_NEAR(tu_line[3 * i + 2], 0.0, tol);
+        for (int n = 0; n < 9; ++n) {
+            const amrex::Real expected = (n == 0 || n == 8) ? 0.5 : 0.0;
+            EXPECT_NEAR(uu_line[9 * i + n], expected, tol);
+        }
+        for (int n = 0; n < 27; ++n) {
+            EXPECT_NEAR(uuu_line[27 * i + n], 0.0, tol);
+        }
+    }
+
+    // A standalone moment gives the same result as the shared engine
+    amr_wind::SecondMomentAveraging uu_ref(pa_vel, pa_vel);
+    uu_ref();
+    for (int i = 0; i < ncell * 9; ++i) {
+        EXPECT_NEAR(uu_ref.line_moment()[i], uu_line[i], tol);
+    }
+}
+
+} // namespace amr_wind_tests
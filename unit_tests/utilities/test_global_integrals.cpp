@@ -0,0 +1,121 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/GlobalIntegrals.H"
+
+namespace amr_wind_tests {
+
+class GlobalIntegralsTest : public MeshTest
+{};
+
+TEST_F(GlobalIntegralsTest, fused_evaluation)
+{
+    constexpr double tol = 1.0e-10;
+    constexpr amrex::Real shear = 0.5;
+
+    populate_parameters();
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& velocity = repo.declare_field("velocity", 3, 1);
+    auto& density = repo.declare_field("density", 1, 1);
+    density.setVal(2.0);
+
+    // Simple shear flow with a uniform spanwise velocity
+    auto init_vel = [&](const amrex::Real w) {
+        run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& dx = mesh().Geom(lev).CellSizeArray();
+            const auto& vel = velocity(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    vel(i, j, k, 0) = shear * (j + 0.5) * dx[1];
+                    vel(i, j, k, 1) = 0.0;
+                    vel(i, j, k, 2) = w;
+                });
+        });
+        velocity.mark_modified();
+    };
+    init_vel(1.0);
+
+    using Factor = amr_wind::GlobalIntegrals::Factor;
+    using FactorOp = amr_wind::GlobalIntegrals::FactorOp;
+    auto& integrals = sim().integrals();
+    const int mass_idx = integrals.add_integrand({Factor{&density}});
+    const int mom_idx = integrals.add_integrand(
+        {Factor{&velocity, FactorOp::Comp, 2}, Factor{&density}}, 0.5);
+    const int enst_idx = integrals.add_integrand(
+        {Factor{&density}, Factor{&velocity, FactorOp::VorticityMagSq}}, 1.0,
+        true, 0);
+    EXPECT_EQ(integrals.num_integrands(), 3);
+
+    const amrex::Real vol = mesh().Geom(0).ProbDomain().volume();
+    EXPECT_NEAR(integrals.value(mass_idx), 2.0 * vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 1);
+
+    // Integrals due at this timestep were computed in the same sweep
+    EXPECT_NEAR(integrals.value(mom_idx), vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 1);
+
+    // On-demand integrals are evaluated separately
+    EXPECT_NEAR(integrals.value(enst_idx), 2.0 * shear * shear * vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 2);
+    EXPECT_NEAR(integrals.value(mass_idx), 2.0 * vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 2);
+
+    // Modified data is picked up without advancing the timestep
+    init_vel(3.0);
+    EXPECT_NEAR(integrals.value(mom_idx), 3.0 * vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 3);
+
+    // A new timestep triggers a new evaluation
+    ++sim().time().time_index();
+    EXPECT_NEAR(integrals.value(mass_idx), 2.0 * vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 4);
+
+    // Masks are cached while the grids are unchanged
+    const auto& mask = integrals.fine_mask(0);
+    EXPECT_EQ(&integrals.fine_mask(0), &mask);
+    EXPECT_EQ(mask.min(0), 1);
+}
+
+TEST_F(GlobalIntegralsTest, many_fields)
+{
+    constexpr double tol = 1.0e-10;
+    constexpr int nfields = 2 * amr_wind::GlobalIntegrals::max_fields + 1;
+
+    populate_parameters();
+    initialize_mesh();
+
+    using Factor = amr_wind::GlobalIntegrals::Factor;
+    using FactorOp = amr_wind::GlobalIntegrals::FactorOp;
+    auto& repo = sim().repo();
+    auto& integrals = sim().integrals();
+
+    // More fields than fit within a single group of integrands
+    amrex::Vector<int> idx;
+    for (int n = 0; n < nfields; ++n) {
+        auto& fld = repo.declare_field("scalar" + std::to_string(n), 1, 1);
+        fld.setVal(n + 1.0);
+        idx.push_back(integrals.add_integrand(
+            {Factor{&fld, FactorOp::Comp, 0}, Factor{&fld, FactorOp::Comp, 0}},
+            1.0, false));
+    }
+
+    // Integrands registered after the tables are full are still accepted
+    auto& velocity = repo.declare_field("velocity", 3, 1);
+    velocity.setVal(2.0);
+    const auto& scalar0 = repo.get_field("scalar0");
+    const int ke_idx = integrals.add_integrand(
+        {Factor{&velocity, FactorOp::MagSq}, Factor{&scalar0}}, 0.5);
+    EXPECT_EQ(integrals.num_integrands(), nfields + 1);
+
+    const amrex::Real vol = mesh().Geom(0).ProbDomain().volume();
+    for (int n = 0; n < nfields; ++n) {
+        EXPECT_NEAR(integrals.value(idx[n]), (n + 1.0) * (n + 1.0) * vol, tol);
+    }
+    EXPECT_NEAR(integrals.value(ke_idx), 6.0 * vol, tol);
+    EXPECT_EQ(integrals.num_evaluations(), 1);
+}
+
+} // namespace amr_wind_tests
@@ -97,6 +97,36 @@ TEST_F(NestRefineTest, box_refine)
     EXPECT_TRUE(ba1.contains(ba2));
 }
 
+TEST_F(NestRefineTest, fine_mask)
+{
+    setup_refinement_inputs();
+    std::stringstream ss;
+    ss << "1 // Number of levels" << std::endl;
+    ss << "2 // Number of boxes at this level" << std::endl;
+    ss << "-10.0 -75.0 0.0 15.0 -65.0 20.0" << std::endl;
+    ss << "-10.0  25.0 0.0 15.0  35.0 20.0" << std::endl;
+
+    create_mesh_instance<NestRefineMesh>();
+    std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+        new amr_wind::CartBoxRefinement(sim()));
+    box_refine->read_inputs(mesh(), ss);
+    mesh<NestRefineMesh>()->refine_criteria_vec().push_back(
+        std::move(box_refine));
+    initialize_mesh();
+
+    const auto& repo = sim().repo();
+    const auto& mask0 = repo.fine_mask(0);
+    const auto& mask1 = repo.fine_mask(1);
+
+    // Masks are cached between calls
+    EXPECT_EQ(&repo.fine_mask(0), &mask0);
+
+    // Level 0 cells covered by level 1 are masked out
+    const amrex::Long ncovered = mesh().boxArray(0).numPts() - mask0.sum(0);
+    EXPECT_EQ(ncovered, mesh().boxArray(1).numPts() / 8);
+    EXPECT_EQ(mask1.min(0), 1);
+}
+
 /*  Check that the implementation emits a warning when the levels requested in
  *  the input file does not match the levels in static refinement file
  */
@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
 #include "amr-wind/utilities/sampling/PlaneSampler.H"
+#include "amr-wind/utilities/sampling/LineSampler.H"
 
 namespace amr_wind_tests {
 
@@ -59,6 +60,22 @@ protected:
     }
 };
 
+class MovingLineSampler : public amr_wind::sampling::LineSampler
+{
+public:
+    explicit MovingLineSampler(const amr_wind::CFDSim& sim)
+        : amr_wind::sampling::LineSampler(sim)
+    {}
+
+    bool is_moving() const override { return true; }
+
+    void update_sampling_locations() override
+    {
+        m_start[0] += 32.0;
+        m_end[0] += 32.0;
+    }
+};
+
 } // namespace
 
 class SamplingTest : public MeshTest
@@ -220,6 +237,62 @@ TEST_F(SamplingTest, sampling)
     probes.post_advance_work();
 }
 
+TEST_F(SamplingTest, update_particle_locations)
+{
+    initialize_mesh();
+    {
+        amrex::ParmParse pp("line1");
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{2.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{2.0, 66.0, 127.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    samplers.emplace_back(std::make_unique<MovingLineSampler>(sim()));
+    samplers[0]->id() = 0;
+    samplers[0]->initialize("line1");
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(1);
+    sc.initialize_particles(samplers);
+    sc.Redistribute();
+
+    const int lev = 0;
+    for (int n = 1; n < 4; ++n) {
+        samplers[0]->update_sampling_locations();
+        sc.update_particle_locations(samplers);
+        sc.Redistribute();
+
+        const amrex::Real xexpected = 2.0 + 32.0 * n;
+        int num_particles = 0;
+        amrex::Real xmin = std::numeric_limits<amrex::Real>::max();
+        amrex::Real xmax = std::numeric_limits<amrex::Real>::lowest();
+        for (amr_wind::sampling::SamplingContainer::ParIterType pti(sc, lev);
+             pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            const auto& pvec = pti.GetArrayOfStructs()();
+            amrex::Vector<
+                amr_wind::sampling::SamplingContainer::ParticleType>
+                hvec(np);
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, pvec.begin(), pvec.end(),
+                hvec.begin());
+            for (const auto& p : hvec) {
+                xmin = amrex::min(xmin, p.pos(0));
+                xmax = amrex::max(xmax, p.pos(0));
+            }
+            num_particles += np;
+        }
+        amrex::ParallelDescriptor::ReduceIntSum(num_particles);
+        amrex::ParallelDescriptor::ReduceRealMin(xmin);
+        amrex::ParallelDescriptor::ReduceRealMax(xmax);
+
+        EXPECT_EQ(num_particles, 16);
+        EXPECT_NEAR(xmin, xexpected, 1.0e-12);
+        EXPECT_NEAR(xmax, xexpected, 1.0e-12);
+    }
+}
+
 TEST_F(SamplingTest, plane_sampler)
 {
     initialize_mesh();
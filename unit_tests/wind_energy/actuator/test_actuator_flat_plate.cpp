@@ -15,30 +15,8 @@
 
 namespace amr_wind_tests {
 namespace {
-class ActFlatPlateTest : public MeshTest
-{
-protected:
-    void populate_parameters() override
-    {
-        MeshTest::populate_parameters();
-
-        {
-            amrex::ParmParse pp("amr");
-            amrex::Vector<int> ncell{{32, 32, 32}};
-            pp.add("max_level", 0);
-            pp.add("max_grid_size", 16);
-            pp.addarr("n_cell", ncell);
-        }
-        {
-            amrex::ParmParse pp("geometry");
-            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
-            amrex::Vector<amrex::Real> probhi{{32.0, 32.0, 32.0}};
-
-            pp.addarr("prob_lo", problo);
-            pp.addarr("prob_hi", probhi);
-        }
-    }
-};
+class ActFlatPlateTest : public ActuatorDomainTest
+{};
 
 namespace act = amr_wind::actuator;
 namespace vs = amr_wind::vs;
@@ -175,17 +153,6 @@ template class ::amr_wind::actuator::
 
 namespace amr_wind_tests {
 
-class ActPhysicsTest : public ::amr_wind::actuator::Actuator
-{
-public:
-    explicit ActPhysicsTest(::amr_wind::CFDSim& sim)
-        : ::amr_wind::actuator::Actuator(sim)
-    {}
-
-protected:
-    void prepare_outputs() override {}
-};
-
 TEST_F(ActFlatPlateTest, act_model_init)
 {
     initialize_mesh();
@@ -216,6 +183,75 @@ TEST_F(ActFlatPlateTest, act_model_init)
     EXPECT_EQ(info.procs.size(), amrex::ParallelDescriptor::NProcs());
 }
 
+TEST_F(ActFlatPlateTest, binned_spreading)
+{
+    initialize_mesh();
+    auto& src = sim().repo().declare_field("actuator_src_term", 3, 0);
+    {
+        amrex::ParmParse pp("Actuator.TestFlatPlateLine");
+        pp.add("num_points", 21);
+        pp.addarr("start", amrex::Vector<amrex::Real>{8.0, 6.0, 15.3});
+        pp.addarr("end", amrex::Vector<amrex::Real>{8.0, 26.0, 15.3});
+        pp.addarr("epsilon", amrex::Vector<amrex::Real>{1.0, 1.0, 0.5});
+        pp.add("pitch", 6.0);
+    }
+    {
+        // Use a coarse bin lattice to exercise the bin size limiter
+        amrex::ParmParse pp("Actuator.F2");
+        pp.add("binned_spreading", true);
+        pp.add("spreading_max_bins", 3);
+    }
+
+    ::amr_wind::actuator::ActModel<FlatPlate> plate_ref(sim(), "F1", 0);
+    ::amr_wind::actuator::ActModel<FlatPlate> plate_bin(sim(), "F2", 1);
+    amrex::Vector<int> act_proc_count(amrex::ParallelDescriptor::NProcs(), 0);
+    auto init_model = [&](::amr_wind::actuator::ActuatorModel& model,
+                          const std::string& label) {
+        amr_wind::actuator::utils::ActParser pp(
+            "Actuator.TestFlatPlateLine", "Actuator." + label);
+        model.read_inputs(pp);
+        model.determine_root_proc(act_proc_count);
+        model.determine_influenced_procs();
+        model.init_actuator_source();
+
+        // Provide velocities expected by the test UpdateVelOp
+        const int npts = model.num_velocity_points();
+        amr_wind::actuator::VecList pos(npts);
+        amr_wind::actuator::VecList vel(npts);
+        auto pslice = ::amr_wind::utils::slice(pos, 0, npts);
+        model.update_positions(pslice);
+        for (int i = 0; i < npts; ++i) {
+            const amrex::Real val = pos[i].x() + pos[i].y() + pos[i].z();
+            vel[i] = vs::Vector{val, val, val};
+        }
+        const auto vslice = ::amr_wind::utils::slice(vel, 0, npts);
+        model.update_velocities(vslice);
+        model.compute_forces();
+    };
+    init_model(plate_ref, "F1");
+    init_model(plate_bin, "F2");
+
+    auto compute_src = [&](::amr_wind::actuator::ActuatorModel& model) {
+        src.setVal(0.0);
+        const auto& geom = sim().mesh().Geom(0);
+        for (amrex::MFIter mfi(src(0)); mfi.isValid(); ++mfi) {
+            model.compute_source_term(0, mfi, geom);
+        }
+    };
+
+    compute_src(plate_ref);
+    amrex::MultiFab ref_src(
+        src(0).boxArray(), src(0).DistributionMap(), 3, 0);
+    amrex::MultiFab::Copy(ref_src, src(0), 0, 0, 3, 0);
+    EXPECT_GT(ref_src.norm0(0) + ref_src.norm0(2), 0.0);
+
+    compute_src(plate_bin);
+    amrex::MultiFab::Subtract(ref_src, src(0), 0, 0, 3, 0);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        EXPECT_NEAR(ref_src.norm0(i), 0.0, 1.0e-12);
+    }
+}
+
 TEST_F(ActFlatPlateTest, actuator_init)
 {
     initialize_mesh();
@@ -17,47 +17,9 @@ struct Joukowsky : public act::Joukowsky
     static std::string identifier() { return "TestJoukowsky"; }
 };
 
-class ActJoukowskyTest : public MeshTest
+class ActJoukowskyTest : public ActuatorDomainTest
 {
 protected:
-    void populate_parameters() override
-    {
-        MeshTest::populate_parameters();
-
-        {
-            amrex::ParmParse pp("amr");
-            amrex::Vector<int> ncell{{32, 32, 32}};
-            pp.add("max_level", 0);
-            pp.add("max_grid_size", 16);
-            pp.addarr("n_cell", ncell);
-        }
-        {
-            amrex::ParmParse pp("geometry");
-            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
-            amrex::Vector<amrex::Real> probhi{{32.0, 32.0, 32.0}};
-
-            pp.addarr("prob_lo", problo);
-            pp.addarr("prob_hi", probhi);
-        }
-    }
-
-    void intialize_domain()
-    {
-        initialize_mesh();
-        sim().repo().declare_field("actuator_src_term", 3, 0);
-        auto& vel = sim().repo().declare_field("velocity", 3, 3);
-        vel.setVal(10.0, 0, 1, 3);
-        amr_wind::actuator::ActuatorContainer::ParticleType::NextID(1U);
-    }
-
-    static void
-    add_actuators(const std::string& type, amrex::Vector<std::string> labels)
-    {
-        amrex::ParmParse pp("Actuator");
-        pp.add("type", type);
-        pp.addarr("labels", labels);
-    }
-
     static void basic_disk_setup()
     {
         amrex::ParmParse pp("Actuator.TestJoukowskyDisk");
@@ -169,20 +131,9 @@ template class ::amr_wind::actuator::
 } // namespace amr_wind
 
 namespace amr_wind_tests {
-class ActPhysicsTest : public ::amr_wind::actuator::Actuator
-{
-public:
-    explicit ActPhysicsTest(::amr_wind::CFDSim& sim)
-        : ::amr_wind::actuator::Actuator(sim)
-    {}
-
-protected:
-    void prepare_outputs() final {}
-};
-
 TEST_F(ActJoukowskyTest, parsing_operations)
 {
-    intialize_domain();
+    initialize_domain();
     basic_disk_setup();
     add_actuators("TestJoukowskyDisk", {"D1"});
     ActPhysicsTest act(sim());
@@ -191,11 +142,51 @@ TEST_F(ActJoukowskyTest, parsing_operations)
 
 TEST_F(ActJoukowskyTest, execution)
 {
-    intialize_domain();
+    initialize_domain();
     basic_disk_setup();
     add_actuators("TestJoukowskyDisk", {"D1"});
     ActPhysicsTest act(sim());
     act.pre_init_actions();
     act.post_init_actions();
 }
-} // namespace amr_wind_tests
\ No newline at end of file
+
+TEST_F(ActJoukowskyTest, binned_spreading)
+{
+    initialize_domain();
+    basic_disk_setup();
+    {
+        amrex::ParmParse pp("Actuator.TestJoukowskyDisk");
+        pp.add("num_points_t", 12);
+        pp.add("num_points_r", 6);
+    }
+    auto& src = sim().repo().get_field("actuator_src_term");
+
+    add_actuators("TestJoukowskyDisk", {"D1"});
+    amrex::MultiFab ref_src(src(0).boxArray(), src(0).DistributionMap(), 3, 0);
+    {
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+        amrex::MultiFab::Copy(ref_src, src(0), 0, 0, 3, 0);
+    }
+    const amrex::Real ref_max = ref_src.norm0(0);
+    EXPECT_GT(ref_max, 0.0);
+
+    {
+        amrex::ParmParse pp("Actuator.D2");
+        pp.add("binned_spreading", true);
+    }
+    add_actuators("TestJoukowskyDisk", {"D2"});
+    {
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+
+    // The normal Gaussian is truncated at 4 epsilon instead of 16 epsilon
+    amrex::MultiFab::Subtract(ref_src, src(0), 0, 0, 3, 0);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        EXPECT_NEAR(ref_src.norm0(i), 0.0, 1.0e-6 * ref_max);
+    }
+}
+} // namespace amr_wind_tests
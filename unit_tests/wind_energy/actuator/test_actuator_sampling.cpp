@@ -6,6 +6,7 @@
 #include "amr-wind/core/vs/vector_space.H"
 
 #include <algorithm>
+#include <set>
 
 namespace amr_wind_tests {
 namespace {
@@ -168,4 +169,83 @@ TEST_F(ActuatorTest, act_container)
     }
 }
 
+TEST_F(ActuatorTest, act_container_neighborhood)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    if (nprocs > 2) {
+        GTEST_SKIP();
+    }
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 3);
+    init_field(vel);
+
+    const int num_turbines = 2;
+    const int num_nodes = 16;
+
+    TestActContainer ac(mesh(), num_turbines);
+    auto& data = ac.get_data_obj();
+
+    for (int it = 0; it < num_turbines; ++it) {
+        data.num_pts[it] = num_nodes;
+    }
+
+    std::set<int> procs;
+    for (int ip = 0; ip < nprocs; ++ip) {
+        procs.insert(ip);
+    }
+    ac.use_neighborhood_exchange(procs);
+    ac.initialize_container();
+
+    {
+        const int lev = 0;
+        int idx = 0;
+        const amrex::Real dz = mesh().Geom(lev).CellSize(2);
+        const amrex::Real ypos = 32.0 * (iproc + 1);
+        auto& pvec = data.position;
+        for (int it = 0; it < num_turbines; ++it) {
+            const amrex::Real xpos = 32.0 * (it + 1);
+            for (int ni = 0; ni < num_nodes; ++ni) {
+                const amrex::Real zpos = (ni + 0.5) * dz;
+
+                pvec[idx].x() = xpos;
+                pvec[idx].y() = ypos;
+                pvec[idx].z() = zpos;
+                ++idx;
+            }
+        }
+        ASSERT_EQ(idx, ac.num_actuator_points());
+    }
+
+    // Sample twice to exercise the setup of the communication pattern and its
+    // reuse in subsequent timesteps
+    for (int n = 0; n < 2; ++n) {
+        ac.update_positions();
+        ac.sample_velocities(vel);
+    }
+
+    // No particles are created with the neighborhood exchange
+    ASSERT_EQ(ac.TotalNumberOfParticles(), 0);
+
+    // Check the interpolated velocity field
+    {
+        namespace vs = amr_wind::vs;
+        constexpr amrex::Real rtol = 1.0e-12;
+        amrex::Real rerr = 0.0;
+        const int npts = ac.num_actuator_points();
+        const auto& pvec = data.position;
+        const auto& vvec = data.velocity;
+        for (int ip = 0; ip < npts; ++ip) {
+            const auto& pos = pvec[ip];
+            const auto& pvel = vvec[ip];
+
+            const amrex::Real vval = pos.x() + pos.y() + pos.z();
+            const vs::Vector vgold{vval, vval, vval};
+            rerr += vs::mag_sqr(pvel - vgold);
+        }
+        EXPECT_NEAR(rerr, 0.0, rtol);
+    }
+}
+
 } // namespace amr_wind_tests
@@ -92,4 +92,55 @@ TEST(Airfoil, airfoil_lookup)
     }
 }
 
+TEST(Airfoil, uniform_lookup)
+{
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+    auto ss = generate_openfast_airfoil();
+    auto ss_uni = generate_openfast_airfoil();
+
+    auto af = AirfoilLoader::load_openfast_airfoil(ss);
+    auto af_uni = AirfoilLoader::load_openfast_airfoil(ss_uni);
+    EXPECT_FALSE(af_uni->is_uniform());
+    af_uni->resample_uniform(::amr_wind::utils::radians(0.5));
+    EXPECT_TRUE(af_uni->is_uniform());
+
+    // Include angles outside the range of the table
+    const int npts = 121;
+    amrex::Vector<amrex::Real> aoa(npts);
+    for (int i = 0; i < npts; ++i) {
+        aoa[i] = ::amr_wind::utils::radians(-185.0 + 0.3 * i);
+    }
+
+    amrex::Vector<amrex::Real> cl, cd;
+    af_uni->lookup(aoa, cl, cd);
+    ASSERT_EQ(cl.size(), aoa.size());
+    ASSERT_EQ(cd.size(), aoa.size());
+
+    // The table breakpoints lie on the uniform grid, so the resampled polars
+    // reproduce the piecewise linear interpolation
+    constexpr amrex::Real tol = 1.0e-12;
+    for (int i = 0; i < npts; ++i) {
+        amrex::Real cl_gold, cd_gold, cm_gold;
+        (*af)(aoa[i], cl_gold, cd_gold, cm_gold);
+        EXPECT_NEAR(cl[i], cl_gold, tol);
+        EXPECT_NEAR(cd[i], cd_gold, tol);
+
+        amrex::Real cl_uni, cd_uni, cm_uni;
+        (*af_uni)(aoa[i], cl_uni, cd_uni, cm_uni);
+        EXPECT_NEAR(cl_uni, cl_gold, tol);
+        EXPECT_NEAR(cd_uni, cd_gold, tol);
+        EXPECT_NEAR(cm_uni, cm_gold, tol);
+    }
+
+    // Coarser grid no longer matches the breakpoints but stays close
+    af_uni->resample_uniform(::amr_wind::utils::radians(3.0));
+    af_uni->lookup(aoa, cl, cd);
+    for (int i = 0; i < npts; ++i) {
+        amrex::Real cl_gold, cd_gold;
+        (*af)(aoa[i], cl_gold, cd_gold);
+        EXPECT_NEAR(cl[i], cl_gold, 0.05);
+        EXPECT_NEAR(cd[i], cd_gold, 0.05);
+    }
+}
+
 } // namespace amr_wind_tests
@@ -23,6 +23,33 @@ protected:
         }
     }
 };
+
+class UniformCtSpreadingTest : public ActuatorDomainTest
+{
+protected:
+    void populate_parameters() override
+    {
+        ActuatorDomainTest::populate_parameters();
+
+        {
+            // Smaller boxes to exercise the tile skipping
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 8);
+        }
+        {
+            amrex::ParmParse pp("Actuator.UniformCtDisk");
+            pp.add("num_force_points", 5);
+            pp.add("num_theta_force_points", 16);
+            pp.add("epsilon", 1.5);
+            pp.add("density", 1.0);
+            pp.add("rotor_diameter", 12.0);
+            pp.addarr(
+                "disk_center", amrex::Vector<amrex::Real>{16.0, 16.0, 16.0});
+            pp.add("yaw", 30.0);
+            pp.addarr("thrust_coeff", amrex::Vector<amrex::Real>{0.8});
+        }
+    }
+};
 } // namespace
 
 namespace act = amr_wind::actuator;
@@ -250,4 +277,50 @@ TEST_F(UniformCtTest, sample_yawed_normal_is_opposite_expected_wind_dir)
         }
     }
 }
+
+TEST_F(UniformCtSpreadingTest, binned_spreading)
+{
+    initialize_domain();
+    auto& src = sim().repo().get_field("actuator_src_term");
+    amrex::MultiFab ref_src(src(0).boxArray(), src(0).DistributionMap(), 3, 0);
+
+    auto compute_src = [&](const std::string& label) {
+        add_actuators("UniformCtDisk", {label});
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    };
+
+    int idx = 0;
+    for (const std::string stype : {"UniformGaussian", "LinearBasis"}) {
+        const std::string ref_label = "R" + std::to_string(idx);
+        const std::string bin_label = "B" + std::to_string(idx);
+        ++idx;
+        {
+            amrex::ParmParse pp("Actuator." + ref_label);
+            pp.add("spreading_type", stype);
+        }
+        {
+            // Use a coarse bin lattice to exercise the bin size limiter
+            amrex::ParmParse pp("Actuator." + bin_label);
+            pp.add("spreading_type", stype);
+            pp.add("binned_spreading", true);
+            pp.add("spreading_max_bins", 3);
+        }
+
+        compute_src(ref_label);
+        amrex::MultiFab::Copy(ref_src, src(0), 0, 0, 3, 0);
+        const amrex::Real ref_max = ref_src.norm0(1);
+        EXPECT_GT(ref_max, 0.0) << stype;
+
+        compute_src(bin_label);
+        amrex::MultiFab::Subtract(ref_src, src(0), 0, 0, 3, 0);
+        // The linear basis kernel in the normal direction is truncated at 4
+        // epsilon instead of 16 epsilon
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            EXPECT_NEAR(ref_src.norm0(i), 0.0, 1.0e-6 * ref_max)
+                << stype << " " << i;
+        }
+    }
+}
 } // namespace amr_wind_tests
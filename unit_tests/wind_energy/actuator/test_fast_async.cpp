@@ -0,0 +1,184 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/wind_energy/actuator/turbine/fast/FastIface.H"
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace amr_wind_tests {
+namespace {
+
+/** OpenFAST interface that records the sequence of operations
+ *
+ *  The substeps block until the gate is opened by the test, so that the
+ *  ordering of the operations on the calling and helper threads is
+ *  deterministic.
+ */
+class StubFastIface : public ::exw_fast::FastIface
+{
+public:
+    explicit StubFastIface(const amr_wind::CFDSim& sim) : FastIface(sim)
+    {
+        m_main_id = std::this_thread::get_id();
+    }
+
+    ~StubFastIface() override { wait_all(); }
+
+    void record(const std::string& event)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_log.push_back(event);
+    }
+
+    std::vector<std::string> log()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_log;
+    }
+
+    std::shared_future<void> gate;
+
+    int num_helper_steps{0};
+
+protected:
+    void step_turbine(::exw_fast::FastTurbine& fi) override
+    {
+        if (gate.valid()) {
+            gate.wait();
+        }
+        if (std::this_thread::get_id() != m_main_id) {
+            ++num_helper_steps;
+        }
+        fi.time_index += fi.num_substeps;
+        record("step:" + fi.tlabel);
+    }
+
+    void write_velocity_data(const ::exw_fast::FastTurbine& fi) override
+    {
+        record("write:" + fi.tlabel);
+    }
+
+private:
+    std::thread::id m_main_id;
+
+    std::mutex m_mutex;
+
+    std::vector<std::string> m_log;
+};
+
+class FastAsyncTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{8, 8, 8}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", 8);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{8.0, 8.0, 8.0}};
+
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+};
+
+void init_turbine_data(
+    ::exw_fast::FastTurbine& fi, const std::string& label, const int gid)
+{
+    fi.tlabel = label;
+    fi.tid_global = gid;
+    fi.num_substeps = 10;
+    fi.dt_fast = 0.00625;
+    fi.stop_time = 10.0;
+    fi.is_solution0 = false;
+}
+
+} // namespace
+
+TEST_F(FastAsyncTest, ordering)
+{
+    initialize_mesh();
+
+    ::exw_fast::FastTurbine fi1, fi2;
+    init_turbine_data(fi1, "T0", 0);
+    init_turbine_data(fi2, "T1", 1);
+
+    StubFastIface fast(sim());
+    fast.register_turbine(fi1);
+    fast.register_turbine(fi2);
+
+    std::promise<void> release;
+    fast.gate = release.get_future().share();
+
+    // The velocities are written before returning, the substeps are blocked
+    fast.advance_turbine_async(fi1.tid_local);
+    fast.advance_turbine_async(fi2.tid_local);
+    EXPECT_TRUE(fast.is_pending(fi1.tid_local));
+    EXPECT_TRUE(fast.is_pending(fi2.tid_local));
+    EXPECT_EQ(fi1.time_index, 0);
+    EXPECT_EQ(fi2.time_index, 0);
+
+    // Work performed by the flow solver while OpenFAST is advancing
+    fast.record("flow");
+    release.set_value();
+
+    fast.wait_turbine(fi1.tid_local);
+    EXPECT_FALSE(fast.is_pending(fi1.tid_local));
+    EXPECT_EQ(fi1.time_index, 10);
+    fast.wait_all();
+    EXPECT_FALSE(fast.is_pending(fi2.tid_local));
+    EXPECT_EQ(fi2.time_index, 10);
+    EXPECT_EQ(fast.num_helper_steps, 2);
+
+    {
+        const auto log = fast.log();
+        ASSERT_EQ(log.size(), 5u);
+        EXPECT_EQ(log[0], "write:T0");
+        EXPECT_EQ(log[1], "write:T1");
+        EXPECT_EQ(log[2], "flow");
+        // The two turbines can be stepped in any order
+        EXPECT_TRUE(
+            ((log[3] == "step:T0") && (log[4] == "step:T1")) ||
+            ((log[3] == "step:T1") && (log[4] == "step:T0")));
+    }
+
+    // Launching a new advance completes the pending one first
+    fast.advance_turbine_async(fi1.tid_local);
+    fast.advance_turbine_async(fi1.tid_local);
+    fast.wait_turbine(fi1.tid_local);
+    EXPECT_EQ(fi1.time_index, 30);
+
+    // Waiting without a pending advance is a no-op
+    fast.wait_turbine(fi1.tid_local);
+    EXPECT_EQ(fi1.time_index, 30);
+
+    // Synchronous advance runs on the calling thread
+    fast.advance_turbine(fi1.tid_local);
+    EXPECT_EQ(fi1.time_index, 40);
+    EXPECT_EQ(fast.num_helper_steps, 4);
+
+    {
+        const auto log = fast.log();
+        ASSERT_EQ(log.size(), 11u);
+        const std::vector<std::string> gold{
+            "write:T0", "step:T0", "write:T0", "step:T0",
+            "write:T0", "step:T0"};
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_EQ(log[5 + i], gold[i]);
+        }
+    }
+}
+
+} // namespace amr_wind_tests
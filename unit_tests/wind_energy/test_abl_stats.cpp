@@ -0,0 +1,63 @@
+#include "abl_test_utils.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/wind_energy/ABLStats.H"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace amr_wind_tests {
+
+TEST_F(ABLMeshTest, inversion_height)
+{
+    constexpr double tol = 1.0e-12;
+
+    populate_parameters();
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 4);
+        pp.add("blocking_factor", 4);
+    }
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    auto& temperature = repo.declare_field("temperature", 1, 1);
+
+    // Temperature profile with a capping inversion at k = 4 for the columns
+    // with i < 4 and at k = 5 for the others. The gradient is largest at the
+    // lower edge of the jump, located at z = 4.5 and z = 5.5 respectively.
+    run_algorithm(temperature, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.growntilebox();
+        const auto& tarr = temperature(lev).array(mfi);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const int k0 = (i < 4) ? 4 : 5;
+            tarr(i, j, k) = 300.0 + 0.1 * k + ((k == k0) ? 3.0 : 0.0) +
+                            ((k > k0) ? 8.0 : 0.0);
+        });
+    });
+
+    temperature.mark_modified();
+
+#ifdef _OPENMP
+    // Each column spans two boxes, so several threads update its maximum
+    const int nthreads = omp_get_max_threads();
+    omp_set_num_threads(4);
+#endif
+
+    const amrex::Real zi = amr_wind::compute_inversion_height(temperature, 2);
+    EXPECT_NEAR(zi, 5.0, tol);
+
+    // Repeated evaluations are deterministic
+    for (int n = 0; n < 10; ++n) {
+        const amrex::Real zi_again =
+            amr_wind::compute_inversion_height(temperature, 2);
+        EXPECT_EQ(zi, zi_again);
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(nthreads);
+#endif
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,119 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/physics/SyntheticTurbulence.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+constexpr int nx = 4;
+constexpr int ny = 5;
+constexpr int nz = 5;
+
+//! Turbulence box where each plane holds distinct perturbation velocities
+void write_turb_file(const std::string& fname)
+{
+    auto ncf = ncutils::NCFile::create(fname, NC_CLOBBER | NC_NETCDF4);
+    ncf.def_dim("ndim", AMREX_SPACEDIM);
+    ncf.def_dim("nx", nx);
+    ncf.def_dim("ny", ny);
+    ncf.def_dim("nz", nz);
+    auto box_len = ncf.def_array("box_lengths", NC_DOUBLE, {"ndim"});
+    auto dx = ncf.def_array("dx", NC_DOUBLE, {"ndim"});
+    auto uvel = ncf.def_array("uvel", NC_DOUBLE, {"nx", "ny", "nz"});
+    auto vvel = ncf.def_array("vvel", NC_DOUBLE, {"nx", "ny", "nz"});
+    auto wvel = ncf.def_array("wvel", NC_DOUBLE, {"nx", "ny", "nz"});
+    ncf.exit_def_mode();
+
+    const std::vector<double> lengths{{4.0, 4.0, 4.0}};
+    const std::vector<double> spacing{{1.0, 1.0, 1.0}};
+    box_len.put(lengths.data());
+    dx.put(spacing.data());
+
+    std::vector<double> uu(nx * ny * nz), vv(nx * ny * nz), ww(nx * ny * nz);
+    for (int i = 0; i < nx; ++i) {
+        for (int j = 0; j < ny; ++j) {
+            for (int k = 0; k < nz; ++k) {
+                const int idx = (i * ny + j) * nz + k;
+                uu[idx] = 1.0 + i + 0.1 * j + 0.01 * k;
+                vv[idx] = -1.0 - 2.0 * i + 0.1 * k;
+                ww[idx] = 0.5 * i * i - 0.1 * j;
+            }
+        }
+    }
+    uvel.put(uu.data());
+    vvel.put(vv.data());
+    wvel.put(ww.data());
+    ncf.close();
+}
+
+} // namespace
+
+class SynthTurbTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("SynthTurb");
+            pp.add("turbulence_file", m_fname);
+            pp.add("wind_direction", 270.0);
+            pp.addarr(
+                "grid_location", amrex::Vector<amrex::Real>{4.0, 4.0, 4.0});
+            pp.add("mean_wind_type", std::string("ConstValue"));
+            pp.add("grid_spacing", 1.0);
+        }
+        {
+            amrex::ParmParse pp("ConstValue.velocity");
+            pp.addarr("value", amrex::Vector<amrex::Real>{1.0, 0.0, 0.0});
+        }
+    }
+
+    const std::string m_fname{"synth_turb_prefetch.nc"};
+};
+
+TEST_F(SynthTurbTest, prefetch_matches_sync_reads)
+{
+    initialize_mesh();
+    write_turb_file(m_fname);
+    auto& repo = sim().repo();
+    repo.declare_field("velocity", 3, 1);
+    auto& density = repo.declare_field("density", 1, 1);
+    density.setVal(1.0);
+
+    amr_wind::SyntheticTurbulence sync_turb(sim());
+    {
+        amrex::ParmParse pp("SynthTurb");
+        pp.add("prefetch_planes", 3);
+    }
+    amr_wind::SyntheticTurbulence prefetch_turb(sim());
+
+    auto& turb_force = repo.get_field("synth_turb_forcing");
+    amrex::MultiFab ref_force(
+        turb_force(0).boxArray(), turb_force(0).DistributionMap(), 3, 0);
+
+    // The planes cross the end of the box (nx - 1 to 0) twice, and the window
+    // of 3 prefetched planes wraps around before that
+    for (int n = 0; n < 2 * nx + 1; ++n) {
+        sim().time().set_restart_time(n, 0.5 + n);
+
+        turb_force.setVal(0.0);
+        sync_turb.pre_advance_work();
+        amrex::MultiFab::Copy(ref_force, turb_force(0), 0, 0, 3, 0);
+        const amrex::Real ref_max = ref_force.norm0(0);
+        EXPECT_GT(ref_max, 0.0);
+
+        turb_force.setVal(0.0);
+        prefetch_turb.pre_advance_work();
+        amrex::MultiFab::Subtract(ref_force, turb_force(0), 0, 0, 3, 0);
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            EXPECT_NEAR(ref_force.norm0(i), 0.0, 1.0e-14 * ref_max)
+                << "step " << n << " component " << i;
+        }
+    }
+    prefetch_turb.post_evolve_actions();
+}
+
+} // namespace amr_wind_tests